@@ -28,6 +28,7 @@ void RegisterTypedAccess(pybind11::class_<Config> &wrapper);
 void RegisterExtendedUtils(pybind11::class_<Config> &wrapper);
 
 std::string PyObjToString(pybind11::handle path);
+std::string PyTypeName(pybind11::handle obj);
 
 werkzeugkiste::config::date PyObjToDate(pybind11::handle obj);
 werkzeugkiste::config::time PyObjToTime(pybind11::handle obj);
@@ -42,6 +43,9 @@ werkzeugkiste::config::Configuration PyDictToConfiguration(
 void ExtractPyIterable(werkzeugkiste::config::Configuration &cfg,
     std::string_view key,
     pybind11::handle lst);
+bool PyObjEqualsParameter(const werkzeugkiste::config::Configuration &cfg,
+    std::string &key,
+    pybind11::handle value);
 }  // namespace werkzeugkiste::bindings::detail
 
 #include <werkzeugkiste-bindings/detail/config_bindings_types.h>
@@ -56,6 +60,9 @@ inline void RegisterConfigUtils(pybind11::module &main_module) {
     Allows a unified handling of different configuration formats, *i.e.*
     `TOML <https://toml.io/en/>`__, `JSON <https://www.json.org/>`__ and
     `libconfig <http://hyperrealm.github.io/libconfig/>`__.
+
+    All loading functions release the GIL while parsing, *i.e.* multiple
+    configurations can be loaded concurrently from separate threads.
     )doc";
 
   detail::RegisterEnums(m);
@@ -83,7 +90,7 @@ inline void RegisterConfigUtils(pybind11::module &main_module) {
       * `TOML <https://toml.io/en/>`__
       * `JSON <https://www.json.org/>`__
       * `libconfig <http://hyperrealm.github.io/libconfig/>`__
-      * `YAML <https://yaml.org/>`__ (only for exporting)
+      * `YAML <https://yaml.org/>`__ (requires ``yaml-cpp``)
 
     **Default access** is supported via the indexing operator ``[]``,
     *i.e.* :meth:`__getitem__` and :meth:`__setitem__`.
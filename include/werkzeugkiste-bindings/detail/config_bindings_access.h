@@ -1,6 +1,7 @@
 #ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_ACCESS_H
 #define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_ACCESS_H
 
+#include <pybind11/chrono.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
@@ -10,7 +11,9 @@
 #include <werkzeugkiste/strings/strings.h>
 #include <werkzeugkiste/logging.h>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
@@ -84,22 +87,124 @@ inline void RegisterLoading(pybind11::module &m) {
       Loads a configuration file.
 
       The configuration type will be deduced from the file extension, *i.e.*
-      ``.toml``, ``.json``, or ``.cfg``.
-      For JSON files, the default :class:`~pyzeugkiste.config.NullValuePolicy`
-      will be used, see :meth:`load_json_file`.
+      ``.toml``, ``.json``, ``.cfg``, or ``.yaml`` / ``.yml``.
+      For JSON and YAML files, the default
+      :class:`~pyzeugkiste.config.NullValuePolicy` will be used, see
+      :meth:`load_json_file` and :meth:`load_yaml_file`.
+
+      Gzip-compressed files are detected automatically and decompressed
+      while loading. Their configuration type will be deduced from the
+      extension preceding ``.gz``, *e.g.* ``config.toml.gz``.
 
       Args:
         filename: Path to the configuration file. Can either be a :class:`str` or
           any object that can be represented as a :class:`str`. For example, a
           :class:`pathlib.Path` is also a valid input parameter.
+        cached: If ``True``, the parsed configuration will be stored in a
+          process-wide cache, keyed by the canonical file path. Subsequent
+          cached loads of the same, unmodified (*i.e.* same modification time
+          and size) file share the cached configuration instead of parsing
+          the file again. The shared configuration is only copied upon the
+          first modification of the returned
+          :class:`~pyzeugkiste.config.Config`, *i.e.* read-only access does
+          not require a copy. Use :meth:`Config.copy` to explicitly create
+          a private copy. See :meth:`set_cache_limit`, :meth:`clear_cache`
+          and :meth:`cache_info`.
 
       Raises:
         :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured, *e.g.* the
           file does not exist, the configuration type cannot be deduced, there are
           syntax errors in the file, *etc.*
+        :class:`RuntimeError`: If the file is gzip-compressed, but zlib
+          support is not available.
+      )doc";
+  m.def("load",
+      &Config::LoadFile,
+      doc_string.c_str(),
+      pybind11::arg("filename"),
+      pybind11::arg("cached") = false);
+
+  doc_string = R"doc(
+      Sets the maximum number of configurations held by the cache of
+      :meth:`load`.
+
+      If the cache is full, the least recently used configuration will be
+      removed. Setting the limit to 0 disables caching. The default limit
+      is 64.
+
+      Args:
+        max_entries: Maximum number of cached configuration files.
+      )doc";
+  m.def(
+      "set_cache_limit",
+      [](std::size_t max_entries) {
+        ParsedFileCache::Instance().SetLimit(max_entries);
+      },
+      doc_string.c_str(),
+      pybind11::arg("max_entries"));
+
+  m.def(
+      "clear_cache",
+      []() { ParsedFileCache::Instance().Clear(); },
+      "Removes all configurations from the cache of :meth:`load` and resets "
+      "its statistics.");
+
+  doc_string = R"doc(
+      Returns the statistics of the cache used by :meth:`load`.
+
+      Returns:
+        A :class:`dict` with the keys ``hits``, ``misses``, ``entries``
+        (number of currently cached configurations) and ``limit``.
       )doc";
   m.def(
-      "load", &Config::LoadFile, doc_string.c_str(), pybind11::arg("filename"));
+      "cache_info",
+      []() {
+        const ParsedFileCache::Stats stats =
+            ParsedFileCache::Instance().GetStats();
+        pybind11::dict d{};
+        d["hits"] = stats.hits;
+        d["misses"] = stats.misses;
+        d["entries"] = stats.entries;
+        d["limit"] = stats.limit;
+        return d;
+      },
+      doc_string.c_str());
+
+  doc_string = R"doc(
+      Loads multiple configuration files concurrently.
+
+      The files are parsed on a pool of worker threads (without holding the
+      GIL). As in :meth:`load`, the configuration type of each file will be
+      deduced from its extension.
+
+      Args:
+        filenames: Iterable of configuration file paths. Each path can either be
+          a :class:`str` or any object that can be represented as a
+          :class:`str`, *e.g.* a :class:`pathlib.Path`.
+        num_threads: Maximum number of worker threads. If 0, the number of
+          available hardware threads will be used.
+
+      Returns:
+        A :class:`list` of :class:`~pyzeugkiste.config.Config` instances in the
+        same order as the input ``filenames``.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ParseError`: If any of the files could not
+          be loaded. All files will be processed before raising, *i.e.* the
+          error message lists **all** failed files.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         cfgs = pyc.load_many(['cam1.toml', 'cam2.json', 'cam3.toml'])
+      )doc";
+  m.def("load_many",
+      &Config::LoadMany,
+      doc_string.c_str(),
+      pybind11::arg("filenames"),
+      pybind11::arg("num_threads") = 0);
 
   doc_string = R"doc(
       Loads the configuration from a `TOML <https://toml.io/en/>`__ string.
@@ -118,19 +223,30 @@ inline void RegisterLoading(pybind11::module &m) {
   doc_string = R"doc(
       Loads the configuration from a `TOML <https://toml.io/en/>`__ file.
 
+      Gzip-compressed files are detected automatically and decompressed
+      while loading.
+
       Args:
         filename: Path to the configuration file. Can either be a :class:`str` or
           any object that can be represented as a :class:`str`. For example, a
           :class:`pathlib.Path` is also a valid input parameter.
+        mmap: If ``True``, the file will be memory-mapped and parsed directly
+          from the mapped pages instead of being read into an intermediate
+          buffer. This reduces the peak memory usage for large files. On
+          platforms without ``mmap`` support, the file will be read as usual.
+          Ignored for gzip-compressed files.
 
       Raises:
         :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured,
           *e.g.* if the file does not exist, there were syntax errors, *etc.*
+        :class:`RuntimeError`: If the file is gzip-compressed, but zlib
+          support is not available.
       )doc";
   m.def("load_toml_file",
       &Config::LoadTOMLFile,
       doc_string.c_str(),
-      pybind11::arg("filename"));
+      pybind11::arg("filename"),
+      pybind11::arg("mmap") = false);
 
   doc_string = R"doc(
       Loads the configuration from a `JSON <https://www.json.org/>`__ string.
@@ -153,23 +269,185 @@ inline void RegisterLoading(pybind11::module &m) {
   doc_string = R"doc(
       Loads the configuration from a `JSON <https://www.json.org/>`__ file.
 
+      Gzip-compressed files are detected automatically and decompressed
+      while loading.
+
       Args:
         filename: Path to the configuration file. Can either be a :class:`str` or
           any object that can be represented as a :class:`str`. For example, a
           :class:`pathlib.Path` is also a valid input parameter.
         none_policy: A :class:`~pyzeugkiste.config.NullValuePolicy` enum which
           specifies how ``None`` or ``null`` values should be handled.
+        mmap: If ``True``, the file will be memory-mapped and parsed directly
+          from the mapped pages instead of being read into an intermediate
+          buffer. This reduces the peak memory usage for large files. On
+          platforms without ``mmap`` support, the file will be read as usual.
+          Ignored for gzip-compressed files.
+        lazy: If ``True``, only the top-level structure of the document will
+          be indexed while loading. Each top-level parameter will be parsed
+          the first time it (or any of its nested parameters) is accessed.
+          The file will be memory-mapped, *i.e.* the load latency and memory
+          usage scale with the accessed parameters instead of the file size.
+          Operations which require the full configuration, *e.g.* listing
+          all :meth:`~pyzeugkiste.config.Config.keys`, comparisons, exporting
+          or modifying it, parse all remaining parameters. Syntax errors
+          within a parameter will only be reported upon its first access.
 
       Raises:
         :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured,
           *e.g.* if the file does not exist, there were syntax errors, *etc.*
+        :class:`RuntimeError`: If the file is gzip-compressed, but zlib
+          support is not available.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         registry = pyc.load_json_file('huge-registry.json', lazy=True)
+         # Only the 'service' subtree will be parsed:
+         port = registry.int('service.port')
       )doc";
   m.def("load_json_file",
       &Config::LoadJSONFile,
       doc_string.c_str(),
       pybind11::arg("filename"),
       pybind11::arg("none_policy") =
-          werkzeugkiste::config::NullValuePolicy::Skip);
+          werkzeugkiste::config::NullValuePolicy::Skip,
+      pybind11::arg("mmap") = false,
+      pybind11::arg("lazy") = false);
+
+  doc_string = R"doc(
+      Iterator over the records of a `JSON lines <https://jsonlines.org/>`__
+      file, see :meth:`~pyzeugkiste.config.iter_json_lines`.
+      )doc";
+  pybind11::class_<JSONLinesReader>(m, "JSONLinesIterator", doc_string.c_str())
+      .def(
+          "__iter__",
+          [](JSONLinesReader &self) -> JSONLinesReader & { return self; },
+          pybind11::return_value_policy::reference_internal)
+      .def("__next__", [](JSONLinesReader &self) -> Config {
+        std::optional<werkzeugkiste::config::Configuration> record{};
+        {
+          pybind11::gil_scoped_release release;
+          record = self.Next();
+        }
+        if (!record.has_value()) {
+          throw pybind11::stop_iteration();
+        }
+        return Config::FromConfiguration(std::move(record.value()));
+      });
+
+  doc_string = R"doc(
+      Iterates over the records of a `JSON lines <https://jsonlines.org/>`__
+      (NDJSON) file.
+
+      Each non-empty line must contain a JSON object, which will be returned
+      as a separate :class:`~pyzeugkiste.config.Config`. The file is read in
+      chunks, *i.e.* the memory usage does not depend on the file size.
+      Parsing is performed without holding the GIL.
+
+      Args:
+        filename: Path to the JSON lines file. Can either be a :class:`str` or
+          any object that can be represented as a :class:`str`. For example, a
+          :class:`pathlib.Path` is also a valid input parameter.
+        none_policy: A :class:`~pyzeugkiste.config.NullValuePolicy` enum which
+          specifies how ``None`` or ``null`` values should be handled.
+        prefetch: If greater than 0, a background thread parses up to this
+          number of records ahead of the consumer.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ParseError`: If the file cannot be opened.
+          During iteration, if a line cannot be parsed. The error message
+          includes the line number. Iteration can be continued afterwards.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         for record in pyc.iter_json_lines('telemetry.jsonl', prefetch=16):
+             print(record['timestamp'])
+      )doc";
+  m.def(
+      "iter_json_lines",
+      [](pybind11::handle filename,
+          werkzeugkiste::config::NullValuePolicy none_policy,
+          std::size_t prefetch) {
+        return std::make_unique<JSONLinesReader>(
+            PyObjToString(filename), none_policy, prefetch);
+      },
+      doc_string.c_str(),
+      pybind11::arg("filename"),
+      pybind11::arg("none_policy") =
+          werkzeugkiste::config::NullValuePolicy::Skip,
+      pybind11::arg("prefetch") = 0);
+
+  doc_string = R"doc(
+      Loads a configuration from its binary encoding.
+
+      The binary encoding is created by :meth:`Config.to_binary` and can be
+      decoded without a tokenizer, *i.e.* loading it is considerably faster
+      than parsing a TOML or JSON configuration. For example, configurations
+      can be converted once at build time and loaded from the binary
+      snapshot at runtime.
+
+      Args:
+        data: Either a bytes-like object (*e.g.* :class:`bytes`,
+          :class:`bytearray` or :class:`memoryview`) holding the encoded
+          configuration, or the path to a file containing it. Bytes following
+          the encoded configuration will be ignored.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ParseError`: If the file cannot be read,
+          or the data is not a valid binary configuration (*e.g.* truncated,
+          or created by an incompatible format version).
+
+      .. code-block:: python
+         :caption: Example
+
+         from pathlib import Path
+         from pyzeugkiste import config as pyc
+
+         # At build time:
+         cfg = pyc.load('config.toml')
+         Path('config.bin').write_bytes(cfg.to_binary())
+
+         # At runtime:
+         cfg = pyc.load_binary('config.bin')
+      )doc";
+  m.def("load_binary",
+      &Config::LoadBinary,
+      doc_string.c_str(),
+      pybind11::arg("data"));
+
+  doc_string = R"doc(
+      Monitors a configuration file and its nested configuration files, see
+      :meth:`Config.watch`.
+
+      Monitoring stops when :meth:`stop` is called, or the watcher is
+      garbage collected. A watcher can also be used as a context manager.
+      )doc";
+  pybind11::class_<PyConfigWatcher>(m, "ConfigWatcher", doc_string.c_str())
+      .def("stop",
+          &PyConfigWatcher::Stop,
+          "Stops monitoring and waits for the background thread to finish.",
+          pybind11::call_guard<pybind11::gil_scoped_release>())
+      .def_property_readonly("running",
+          &PyConfigWatcher::IsRunning,
+          "``True`` while the configuration files are monitored.")
+      .def_property_readonly("files",
+          &PyConfigWatcher::Files,
+          "The monitored files, *i.e.* the configuration file followed by "
+          "all nested configuration files.")
+      .def(
+          "__enter__",
+          [](PyConfigWatcher &self) -> PyConfigWatcher & { return self; },
+          pybind11::return_value_policy::reference_internal)
+      .def(
+          "__exit__",
+          [](PyConfigWatcher &self, const pybind11::args &) { self.Stop(); },
+          pybind11::call_guard<pybind11::gil_scoped_release>());
 
   doc_string = R"doc(
       Loads the configuration from a `Libconfig <http://hyperrealm.github.io/libconfig/>`__ string.
@@ -194,6 +472,8 @@ inline void RegisterLoading(pybind11::module &m) {
 
       This functionality requires ``libconfig++``. If CMake can locate the
       library, ``pyzeugkiste`` will be built with libconfig support.
+      Gzip-compressed files are detected automatically and decompressed
+      while loading.
 
       Args:
         filename: Path to the configuration file. Can either be a :class:`str` or
@@ -203,12 +483,75 @@ inline void RegisterLoading(pybind11::module &m) {
       Raises:
         :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured,
           *e.g.* if the file does not exist, there were syntax errors, *etc.*
-        :class:`RuntimeError`: If libconfig support is not available.
+        :class:`RuntimeError`: If libconfig support is not available, or if
+          the file is gzip-compressed, but zlib support is not available.
       )doc";
   m.def("load_libconfig_file",
       &Config::LoadLibconfigFile,
       doc_string.c_str(),
       pybind11::arg("filename"));
+
+  doc_string = R"doc(
+      Loads the configuration from a `YAML <https://yaml.org/>`__ string.
+
+      The document is parsed natively and converted into the configuration
+      without any intermediate python objects. Plain scalars are resolved
+      according to the YAML 1.2 core schema, *i.e.* booleans, integers,
+      floating point numbers, and null values. Additionally, plain dates,
+      times, and date times are loaded as such. Quoted scalars are always
+      loaded as strings.
+
+      This functionality requires ``yaml-cpp``. If CMake can locate the
+      library, ``pyzeugkiste`` will be built with YAML support.
+
+      Args:
+        yaml_str: Configuration as :class:`str`. The top-level node must be
+          a mapping.
+        none_policy: A :class:`~pyzeugkiste.config.NullValuePolicy` enum which
+          specifies how null values should be handled.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured.
+        :class:`RuntimeError`: If YAML support is not available.
+      )doc";
+  m.def("load_yaml_str",
+      &Config::LoadYAMLString,
+      doc_string.c_str(),
+      pybind11::arg("yaml_str"),
+      pybind11::arg("none_policy") =
+          werkzeugkiste::config::NullValuePolicy::Skip);
+
+  doc_string = R"doc(
+      Loads the configuration from a `YAML <https://yaml.org/>`__ file.
+
+      See :meth:`load_yaml_str` for details on the YAML support.
+      Gzip-compressed files are detected automatically and decompressed
+      while loading.
+
+      Args:
+        filename: Path to the configuration file. Can either be a :class:`str` or
+          any object that can be represented as a :class:`str`. For example, a
+          :class:`pathlib.Path` is also a valid input parameter.
+        none_policy: A :class:`~pyzeugkiste.config.NullValuePolicy` enum which
+          specifies how null values should be handled.
+        mmap: If ``True``, the file will be memory-mapped and parsed directly
+          from the mapped pages instead of being read into an intermediate
+          buffer. On platforms without ``mmap`` support, the file will be read
+          as usual. Ignored for gzip-compressed files.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured,
+          *e.g.* if the file does not exist, there were syntax errors, *etc.*
+        :class:`RuntimeError`: If YAML support is not available, or if the
+          file is gzip-compressed, but zlib support is not available.
+      )doc";
+  m.def("load_yaml_file",
+      &Config::LoadYAMLFile,
+      doc_string.c_str(),
+      pybind11::arg("filename"),
+      pybind11::arg("none_policy") =
+          werkzeugkiste::config::NullValuePolicy::Skip,
+      pybind11::arg("mmap") = false);
 }
 
 inline void RegisterBasicOperators(pybind11::class_<Config> &wrapper) {
@@ -282,8 +625,137 @@ inline void RegisterBasicOperators(pybind11::class_<Config> &wrapper) {
       "Checks for inequality, see :meth:`__eq__` for details.",
       pybind11::arg("other"));
 
+  doc_string = R"doc(
+      Computes the differences to another configuration.
+
+      Both parameter trees are compared natively, *i.e.* only the values of
+      differing parameters will be converted to python objects. Groups are
+      compared recursively, whereas lists are compared as a whole.
+
+      Args:
+        other: The :class:`~pyzeugkiste.config.Config` to compare against.
+
+      Returns:
+        A :class:`dict` with the entries ``'added'``, ``'removed'`` and
+        ``'changed'``. Each entry is a :class:`dict` which maps the fully
+        qualified parameter name to its value in ``other`` (added), its
+        value in this configuration (removed), or to a ``(previous, current)``
+        :class:`tuple` (changed), respectively. Groups and lists are
+        returned as :class:`dict` and :class:`list`.
+
+      Raises:
+        :class:`~pyzeugkiste.config.TypeError`: If either configuration is a
+          view on a list.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         prev = pyc.load_toml_str("""
+             name = 'cam'
+             fps = 30
+             [roi]
+             width = 640
+             """)
+         curr = pyc.load_toml_str("""
+             fps = 25
+             [roi]
+             width = 640
+             height = 480
+             """)
+
+         diff = prev.diff(curr)
+         # diff == {
+         #   'added': {'roi.height': 480},
+         #   'removed': {'name': 'cam'},
+         #   'changed': {'fps': (30, 25)}
+         # }
+
+         prev.apply_patch(diff)
+         assert prev == curr
+      )doc";
+  wrapper.def("diff", &Config::Diff, doc_string.c_str(), pybind11::arg("other"));
+
+  doc_string = R"doc(
+      Applies the differences computed by :meth:`diff`.
+
+      Removed parameters will be deleted, changed parameters will be replaced
+      by their current value and added parameters will be inserted. The patch
+      is applied to a copy of the viewed group first. Thus, if any of the
+      changes cannot be applied, the configuration remains unchanged.
+
+      Args:
+        diff: A :class:`dict` as returned by :meth:`diff`. Missing entries
+          (*e.g.* ``'removed'``) will be skipped.
+
+      Raises:
+        :class:`~pyzeugkiste.config.KeyError`: If a removed or changed
+          parameter does not exist.
+        :class:`~pyzeugkiste.config.ValueError`: If a changed parameter is
+          not given as ``(previous, current)`` pair.
+        :class:`~pyzeugkiste.config.TypeError`: If a value cannot be
+          converted to a parameter, or if this is a view on a list.
+      )doc";
+  wrapper.def("apply_patch",
+      &Config::ApplyPatch,
+      doc_string.c_str(),
+      pybind11::arg("diff"));
+
   wrapper.def("copy", &Config::Copy, "Returns a deeply copied configuration.");
 
+  doc_string = R"doc(
+      Returns the content hash of this configuration.
+
+      Equal configurations have the same fingerprint, *i.e.* differing
+      fingerprints imply that the configurations differ.
+
+      The fingerprints of all sub-groups and lists are cached. Upon
+      modification of a parameter, only the cached fingerprints along its
+      path (*i.e.* of the parameter's ancestors and children) are
+      invalidated. Thus, the fingerprint can be recomputed efficiently
+      after modifying a large configuration.
+
+      Returns:
+        The fingerprint as 64-bit unsigned :class:`int`.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         cfg = pyc.load_toml_str("""
+             [camera]
+             fps = 30
+             """)
+         fp = cfg.fingerprint()
+         cfg['camera.fps'] = 25
+         assert cfg.fingerprint() != fp
+      )doc";
+  wrapper.def("fingerprint", &Config::Fingerprint, doc_string.c_str());
+
+  doc_string = R"doc(
+      Makes this configuration immutable.
+
+      Any subsequent modification (of this configuration or any view on it)
+      raises a :class:`~pyzeugkiste.config.TypeError`. Frozen configurations
+      are hashable (see :meth:`fingerprint`) and can thus be used as
+      :class:`dict` keys, *e.g.* to memoize results. A mutable configuration
+      can be obtained via :meth:`copy`.
+      )doc";
+  wrapper.def("freeze", &Config::Freeze, doc_string.c_str());
+
+  wrapper.def_property_readonly("frozen",
+      &Config::IsFrozen,
+      "Returns ``True`` if the configuration has been frozen, see "
+      ":meth:`freeze`.");
+
+  wrapper.def("__hash__",
+      &Config::Hash,
+      "Returns the :meth:`fingerprint` of a frozen configuration. Raises a "
+      ":class:`~pyzeugkiste.config.TypeError` if the configuration is not "
+      "frozen.");
+
   wrapper.def("__contains__",
       &Config::Contains,
       "Checks if the given key/parameter name exists.",
@@ -425,6 +897,7 @@ inline void RegisterBasicOperators(pybind11::class_<Config> &wrapper) {
 
       Aggregate parameters (lists and groups) will be converted to their
       corresponding python type, *i.e.* :class:`list` and :class:`dict`.
+      See :meth:`iter_values` for a lazy alternative.
       )doc";
   wrapper.def("values", &Config::Values, doc_string.c_str());
 
@@ -441,9 +914,83 @@ inline void RegisterBasicOperators(pybind11::class_<Config> &wrapper) {
 
       Aggregate parameters (lists and groups) will be converted to their
       corresponding python type, *i.e.* :class:`list` and :class:`dict`.
+      See :meth:`iter_items` for a lazy alternative.
       )doc";
   wrapper.def("items", &Config::Items, doc_string.c_str());
 
+  doc_string = R"doc(
+      Returns a lazy iterator over the parameter names of this group.
+
+      In contrast to :meth:`keys`, the parameter names are not collected into
+      a :class:`list`.
+
+      Raises:
+        :class:`~pyzeugkiste.config.TypeError`: If this is a view on a list.
+      )doc";
+  wrapper.def(
+      "iter_keys",
+      [](const Config &self) {
+        return pybind11::make_iterator(
+            self.cbegin(Config::IteratorMode::Keys), self.cend());
+      },
+      doc_string.c_str(),
+      pybind11::keep_alive<0, 1>());
+
+  doc_string = R"doc(
+      Returns a lazy iterator over the parameter values of this group.
+
+      In contrast to :meth:`values`, each value is only looked up once it is
+      yielded. Aggregate parameters (lists and groups) are **not** converted,
+      but returned as :class:`~pyzeugkiste.config.Config` views, *i.e.*
+      changing such a view will change the corresponding parameter.
+
+      Raises:
+        :class:`~pyzeugkiste.config.TypeError`: If this is a view on a list.
+      )doc";
+  wrapper.def(
+      "iter_values",
+      [](const Config &self) {
+        return pybind11::make_iterator(
+            self.cbegin(Config::IteratorMode::Values), self.cend());
+      },
+      doc_string.c_str(),
+      pybind11::keep_alive<0, 1>());
+
+  doc_string = R"doc(
+      Returns a lazy iterator over the (key, value) pairs of this group.
+
+      In contrast to :meth:`items`, each value is only looked up once it is
+      yielded. Aggregate parameters (lists and groups) are **not** converted,
+      but returned as :class:`~pyzeugkiste.config.Config` views.
+
+      Raises:
+        :class:`~pyzeugkiste.config.TypeError`: If this is a view on a list.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+         cfg = pyc.load_toml_str("""
+             [cam1]
+             fps = 30
+             [cam2]
+             fps = 25
+             """)
+
+         for name, cam in cfg.iter_items():
+             if cam['fps'] < 30:
+                 # Breaking early skips the remaining lookups
+                 break
+      )doc";
+  wrapper.def(
+      "iter_items",
+      [](const Config &self) {
+        return pybind11::make_iterator(
+            self.cbegin(Config::IteratorMode::Items), self.cend());
+      },
+      doc_string.c_str(),
+      pybind11::keep_alive<0, 1>());
+
   doc_string = R"doc(
       Removes all parameters of this configuration.
 
@@ -482,26 +1029,116 @@ inline void RegisterSerialization(pybind11::class_<Config> &wrapper) {
   wrapper.def("to_toml",
       &Config::ToTOMLString,
       "Returns a `TOML <https://toml.io/>`__-formatted representation "
-      "of this configuration.");
+      "of this configuration.\n\nViews on groups/lists are serialized via a "
+      "copy of the viewed parameters.");
 
   wrapper.def("to_json",
       &Config::ToJSONString,
       "Returns a `JSON <https://www.json.org/>`__-formatted representation "
       "of this configuration.\n\nNote that date/time parameters will be "
-      "replaced by their string representation.");
+      "replaced by their string representation. Views on groups/lists are "
+      "serialized without copying the viewed parameters (with the same "
+      "output as serializing a copy).");
 
   wrapper.def("to_libconfig",
       &Config::ToLibconfigString,
       "Returns a `Libconfig "
       "<http://hyperrealm.github.io/libconfig/>`__-formatted "
       "representation of this configuration.\n\nNote that date/time "
-      "parameters will be replaced by their string representation.");
+      "parameters will be replaced by their string representation. Views on "
+      "groups/lists are serialized via a copy of the viewed parameters.");
 
   wrapper.def("to_yaml",
       &Config::ToYAMLString,
       "Returns a `YAML <https://yaml.org/>`__-formatted representation "
       "of this configuration.\n\nNote that date/time parameters will be "
-      "replaced by their string representation.");
+      "replaced by their string representation. Views on groups/lists are "
+      "serialized via a copy of the viewed parameters.");
+
+  std::string doc_string = R"doc(
+      Serializes this configuration and writes it to a file.
+
+      In contrast to :meth:`to_toml`, :meth:`to_json`, *etc.*, no python
+      :class:`str` holding the full output will be created. Note that the
+      output is not streamed while serializing: The configuration is first
+      serialized into a native buffer (which is as large as the full output)
+      and this buffer is then written chunk by chunk. The GIL is released
+      while serializing and, when writing to a path, while writing.
+      Meanwhile, other threads cannot modify the configuration, *i.e.* they
+      would raise a :class:`~pyzeugkiste.config.TypeError`.
+
+      Args:
+        target: Either a path (:class:`str` or :class:`os.PathLike`), or a
+          file object opened for writing in text or binary mode. Paths ending
+          with ``.gz`` will be gzip-compressed (requires zlib support).
+          File objects will be written chunk by chunk.
+        format: Output format, *i.e.* ``'toml'``, ``'json'``, ``'yaml'``, or
+          ``'libconfig'``. If ``None``, the format will be deduced from the
+          extension of the path, analogous to :meth:`~pyzeugkiste.config.load`.
+          Must be specified for file objects.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ValueError`: If the format is not
+          supported or cannot be deduced.
+        :class:`~pyzeugkiste.config.TypeError`: If `target` is neither a path,
+          nor a file object.
+        :class:`OSError`: If the file cannot be written.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         cfg = pyc.load('huge.json')
+         cfg.dump('huge.toml')
+         cfg.dump('huge.yml.gz')
+         with open('huge.cfg', 'wb') as f:
+             cfg.dump(f, format='libconfig')
+      )doc";
+  wrapper.def("dump",
+      &Config::Dump,
+      doc_string.c_str(),
+      pybind11::arg("target"),
+      pybind11::arg("format") = pybind11::none());
+
+  wrapper.def("to_binary",
+      &Config::ToBinary,
+      "Returns a compact binary representation of this configuration as "
+      ":class:`bytes`, which can be loaded via "
+      ":meth:`~pyzeugkiste.config.load_binary`.\n\nIn contrast to the text "
+      "formats, all parameter types (including date/time types) are "
+      "preserved.");
+
+  // Pickling uses the binary encoding. For protocol 5 and above, the encoded
+  // state is passed as `pickle.PickleBuffer`, which allows transferring it
+  // out-of-band, e.g. via shared memory, without an additional copy.
+  wrapper.def(pybind11::pickle(
+                  [](const Config &c) { return c.PickleState(); },
+                  [](const pybind11::object &state) {
+                    return Config::LoadBinary(state);
+                  }),
+      ":class:`~pyzeugkiste.config.Config` instances can be pickled, "
+      "except for views on lists.");
+
+  wrapper.def(
+      "__reduce_ex__",
+      [](const pybind11::object &self, int protocol) -> pybind11::object {
+        if (protocol < 5) {
+          const pybind11::object base =
+              pybind11::module::import("builtins").attr("object");
+          return base.attr("__reduce_ex__")(self, protocol);
+        }
+        const pybind11::bytes state =
+            self.cast<const Config &>().PickleState();
+        const pybind11::object pickle_buffer =
+            pybind11::module::import("pickle").attr("PickleBuffer");
+        const pybind11::object newobj =
+            pybind11::module::import("copyreg").attr("__newobj__");
+        return pybind11::make_tuple(newobj,
+            pybind11::make_tuple(self.get_type()),
+            pickle_buffer(state));
+      },
+      pybind11::arg("protocol"));
 
   wrapper.def("to_dict",
       &Config::ToDict,
@@ -1297,6 +1934,131 @@ inline void RegisterExtendedUtils(pybind11::class_<Config> &wrapper) {
       doc_string.c_str(),
       pybind11::arg("key"));
 
+  doc_string = R"doc(
+      Loads the nested configurations of all matching parameters.
+
+      Replaces each :class:`str` parameter which matches any of the given
+      names/patterns by the configuration loaded from the referenced file,
+      as in :meth:`load_nested`. Each file is parsed only **once**, even if
+      it is referenced by multiple parameters. The unique files are parsed
+      concurrently on a pool of worker threads (without holding the GIL).
+      As in :meth:`~pyzeugkiste.config.load`, the configuration type of each
+      file will be deduced from its extension.
+
+      Parameter names/patterns are specified as in
+      :meth:`adjust_relative_paths`, *i.e.* a pattern can contain the
+      wildcard ``*``. Non-string parameters which match a pattern will be
+      ignored.
+
+      Args:
+        patterns: A list of parameter names or patterns.
+        num_threads: Maximum number of worker threads. If 0, the number of
+          available hardware threads will be used.
+
+      Returns:
+        The number of replaced parameters.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ParseError`: If any of the nested files
+          could not be loaded. All files will be processed before raising,
+          *i.e.* the error message lists **all** failed files. In this case,
+          the configuration will not be modified.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         cfg = pyc.load_toml_str("""
+             [cam1]
+             lens = 'lens-profile.toml'
+
+             [cam2]
+             lens = 'lens-profile.toml'
+
+             [cam3]
+             lens = 'wide-angle.toml'
+             """)
+
+         # Loads both lens profiles only once
+         cfg.load_all_nested(['*.lens'])
+         print(cfg['cam2.lens'])
+      )doc";
+  wrapper.def("load_all_nested",
+      &Config::LoadAllNested,
+      doc_string.c_str(),
+      pybind11::arg("patterns"),
+      pybind11::arg("num_threads") = 0);
+
+  doc_string = R"doc(
+      Reloads the configuration whenever its file is modified.
+
+      Monitors the file this configuration has been loaded from, as well as
+      all files which have been loaded via :meth:`load_nested` or
+      :meth:`load_all_nested`. Modifications are handled on a background
+      thread: After a burst of modifications has settled, only the modified
+      files are parsed again (without holding the
+      GIL). The reloaded configuration is then assembled from the parsing
+      results of all files, *i.e.* the nested configurations are inserted
+      at the same parameters as before.
+
+      Note that only the file contents are reloaded. Other modifications of
+      this configuration, *e.g.* via :meth:`adjust_relative_paths`, must be
+      applied to the reloaded configuration within the callback. This
+      configuration itself is not modified.
+
+      Currently, monitoring is only supported on Linux.
+
+      Args:
+        callback: Callable which will be invoked with the reloaded
+          :class:`~pyzeugkiste.config.Config` and a :class:`set` holding
+          the fully qualified names of all parameters which have been added,
+          removed or changed. It will not be invoked if the parameters did not
+          change. The callback is invoked from the background thread.
+        debounce: Time to wait for further modifications before the
+          configuration is reloaded, either as :class:`float` (in seconds)
+          or :class:`datetime.timedelta`.
+        on_error: Optional callable which will be invoked with the exception
+          if the configuration could not be reloaded, *e.g.* due to a syntax
+          error. If not set, such errors will be reported as unraisable
+          exceptions (see :func:`sys.unraisablehook`). The previous parsing
+          results will be kept, *i.e.* the next modification triggers
+          another reload attempt.
+
+      Returns:
+        The :class:`~pyzeugkiste.config.ConfigWatcher`. The configuration
+        will be monitored until the watcher is stopped or garbage collected.
+
+      Raises:
+        :class:`~pyzeugkiste.config.ValueError`: If this configuration has not
+          been loaded from a file, or if it is a view on a sub-group.
+        :class:`RuntimeError`: If monitoring is not supported on this
+          platform.
+
+      .. code-block:: python
+         :caption: Example
+
+         from pyzeugkiste import config as pyc
+
+         cfg = pyc.load('service.toml')
+         cfg.load_nested('storage')
+
+         def on_reload(new_cfg, changed_keys):
+             global cfg
+             cfg = new_cfg
+             print('Reloaded configuration, changed:', changed_keys)
+
+         watcher = cfg.watch(on_reload, debounce=0.2)
+         ...
+         watcher.stop()
+      )doc";
+  wrapper.def("watch",
+      &Config::Watch,
+      doc_string.c_str(),
+      pybind11::arg("callback"),
+      pybind11::arg("debounce") = std::chrono::milliseconds{100},
+      pybind11::arg("on_error") = pybind11::none());
+
   doc_string = R"doc(
       Adjusts string parameters which hold relative file paths.
 
@@ -0,0 +1,523 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_BINARY_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_BINARY_H
+
+#include <werkzeugkiste/config/configuration.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief Compact, versioned binary encoding of a configuration tree.
+///
+/// Layout (all multi-byte integers are little endian):
+/// * Header: magic `PZKC`, format version (1 byte), 3 reserved bytes and the
+///   payload length (8 bytes). Trailing bytes after the payload are ignored,
+///   *e.g.* the padding of a shared memory segment.
+/// * Payload: the root group.
+///
+/// Each value is stored as a 1-byte tag followed by its data:
+/// * Boolean: 1 byte.
+/// * Integer: zigzag-encoded varint.
+/// * FloatingPoint: 8 bytes (IEEE 754).
+/// * String: varint length, followed by the UTF-8 bytes.
+/// * Date: varint year, 1 byte month, 1 byte day.
+/// * Time: 1 byte hour, minute and second each, varint nanoseconds.
+/// * DateTime: date, time, 1 byte offset flag and the zigzag-encoded offset
+///   in minutes (only if the flag is set).
+/// * List: varint number of elements, followed by the elements.
+/// * Group: varint number of parameters, followed by (key, value) pairs. Keys
+///   are encoded as strings.
+///
+/// Lengths are prefixed, thus decoding does not require any tokenization.
+/// As the data may stem from untrusted sources (*e.g.* unpickling), groups
+/// and lists can be nested at most `kMaxDepth` levels deep.
+namespace binary {
+inline constexpr char kMagic[4] = {'P', 'Z', 'K', 'C'};
+inline constexpr uint8_t kVersion = 1;
+inline constexpr std::size_t kHeaderSize = 16;
+inline constexpr std::size_t kMaxDepth = 1000;
+
+enum class Tag : uint8_t {
+  Boolean = 1,
+  Integer = 2,
+  FloatingPoint = 3,
+  String = 4,
+  Date = 5,
+  Time = 6,
+  DateTime = 7,
+  List = 8,
+  Group = 9
+};
+
+class Writer {
+ public:
+  Writer() { buffer_.assign(kHeaderSize, '\0'); }
+
+  /// @brief Encodes the group at `fqn` as the root group.
+  void WriteRootGroup(const werkzeugkiste::config::Configuration &cfg,
+      std::string_view fqn) {
+    std::string key{fqn};
+    WriteGroup(cfg, key);
+  }
+
+  /// @brief Encodes the list at `fqn` as the single parameter `wrapper_key`
+  ///   of the root group (as the text serializers do for list views).
+  void WriteRootList(const werkzeugkiste::config::Configuration &cfg,
+      std::string_view fqn,
+      std::string_view wrapper_key) {
+    WriteVarint(1);
+    WriteString(wrapper_key);
+    WriteByte(static_cast<uint8_t>(Tag::List));
+    std::string key{fqn};
+    WriteList(cfg, key);
+  }
+
+  /// @brief Finalizes the header and returns the encoded buffer.
+  std::string Finish() {
+    std::memcpy(buffer_.data(), kMagic, sizeof(kMagic));
+    buffer_[4] = static_cast<char>(kVersion);
+    uint64_t payload_len = buffer_.size() - kHeaderSize;
+    for (std::size_t i = 0; i < 8; ++i) {
+      buffer_[8 + i] = static_cast<char>((payload_len >> (8 * i)) & 0xFFU);
+    }
+    return std::move(buffer_);
+  }
+
+ private:
+  std::string buffer_{};
+
+  void WriteByte(uint8_t byte) { buffer_.push_back(static_cast<char>(byte)); }
+
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80U) {
+      WriteByte(static_cast<uint8_t>(value | 0x80U));
+      value >>= 7U;
+    }
+    WriteByte(static_cast<uint8_t>(value));
+  }
+
+  void WriteSigned(int64_t value) {
+    const auto uvalue = static_cast<uint64_t>(value);
+    WriteVarint((uvalue << 1U) ^ (value < 0 ? ~uint64_t{0} : uint64_t{0}));
+  }
+
+  void WriteDouble(double value) {
+    uint64_t bits{};
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (std::size_t i = 0; i < 8; ++i) {
+      WriteByte(static_cast<uint8_t>((bits >> (8 * i)) & 0xFFU));
+    }
+  }
+
+  void WriteString(std::string_view str) {
+    WriteVarint(str.size());
+    buffer_.append(str.data(), str.size());
+  }
+
+  void WriteDate(const werkzeugkiste::config::date &d) {
+    WriteVarint(static_cast<uint64_t>(d.year));
+    WriteByte(static_cast<uint8_t>(d.month));
+    WriteByte(static_cast<uint8_t>(d.day));
+  }
+
+  void WriteTime(const werkzeugkiste::config::time &t) {
+    WriteByte(static_cast<uint8_t>(t.hour));
+    WriteByte(static_cast<uint8_t>(t.minute));
+    WriteByte(static_cast<uint8_t>(t.second));
+    WriteVarint(static_cast<uint64_t>(t.nanosecond));
+  }
+
+  void WriteDateTime(const werkzeugkiste::config::date_time &dt) {
+    WriteDate(dt.date);
+    WriteTime(dt.time);
+    if (dt.IsLocal()) {
+      WriteByte(0);
+    } else {
+      WriteByte(1);
+      WriteSigned(static_cast<int64_t>(dt.offset.value().minutes));
+    }
+  }
+
+  /// @brief Writes the tagged value at `fqn`. The key buffer `fqn` will be
+  ///   extended for nested parameters and restored before returning.
+  void WriteValue(const werkzeugkiste::config::Configuration &cfg,
+      std::string &fqn) {
+    switch (cfg.Type(fqn)) {
+      case werkzeugkiste::config::ConfigType::Boolean:
+        WriteByte(static_cast<uint8_t>(Tag::Boolean));
+        WriteByte(cfg.GetBool(fqn) ? 1 : 0);
+        break;
+
+      case werkzeugkiste::config::ConfigType::Integer:
+        WriteByte(static_cast<uint8_t>(Tag::Integer));
+        WriteSigned(cfg.GetInt64(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::FloatingPoint:
+        WriteByte(static_cast<uint8_t>(Tag::FloatingPoint));
+        WriteDouble(cfg.GetDouble(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::String:
+        WriteByte(static_cast<uint8_t>(Tag::String));
+        WriteString(cfg.GetString(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::Date:
+        WriteByte(static_cast<uint8_t>(Tag::Date));
+        WriteDate(cfg.GetDate(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::Time:
+        WriteByte(static_cast<uint8_t>(Tag::Time));
+        WriteTime(cfg.GetTime(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::DateTime:
+        WriteByte(static_cast<uint8_t>(Tag::DateTime));
+        WriteDateTime(cfg.GetDateTime(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::List:
+        WriteByte(static_cast<uint8_t>(Tag::List));
+        WriteList(cfg, fqn);
+        break;
+
+      case werkzeugkiste::config::ConfigType::Group:
+        WriteByte(static_cast<uint8_t>(Tag::Group));
+        WriteGroup(cfg, fqn);
+        break;
+    }
+  }
+
+  void WriteList(const werkzeugkiste::config::Configuration &cfg,
+      std::string &fqn) {
+    const std::size_t prefix_len = fqn.length();
+    const std::size_t num_el = cfg.Size(fqn);
+    WriteVarint(num_el);
+    for (std::size_t idx = 0; idx < num_el; ++idx) {
+      fqn += '[';
+      fqn += std::to_string(idx);
+      fqn += ']';
+      WriteValue(cfg, fqn);
+      fqn.resize(prefix_len);
+    }
+  }
+
+  void WriteGroup(const werkzeugkiste::config::Configuration &cfg,
+      std::string &fqn) {
+    const std::size_t prefix_len = fqn.length();
+    const std::vector<std::string> keys = cfg.ListParameterNames(
+        fqn, /*include_array_entries=*/false, /*recursive=*/false);
+    WriteVarint(keys.size());
+    for (const std::string &key : keys) {
+      WriteString(key);
+      if (prefix_len > 0) {
+        fqn += '.';
+      }
+      fqn += key;
+      WriteValue(cfg, fqn);
+      fqn.resize(prefix_len);
+    }
+  }
+};
+
+class Reader {
+ public:
+  explicit Reader(std::string_view data) : data_{data} {}
+
+  /// @brief Validates the header and decodes the root group.
+  werkzeugkiste::config::Configuration ReadRoot() {
+    if ((data_.size() < kHeaderSize) ||
+        (std::memcmp(data_.data(), kMagic, sizeof(kMagic)) != 0)) {
+      Fail("missing header");
+    }
+    const auto version = static_cast<uint8_t>(data_[4]);
+    if (version != kVersion) {
+      Fail("unsupported format version " + std::to_string(version));
+    }
+    uint64_t payload_len{0};
+    for (std::size_t i = 0; i < 8; ++i) {
+      payload_len |= static_cast<uint64_t>(static_cast<uint8_t>(data_[8 + i]))
+                     << (8 * i);
+    }
+    if (payload_len > (data_.size() - kHeaderSize)) {
+      Fail("truncated payload");
+    }
+    data_ = data_.substr(0, kHeaderSize + payload_len);
+    pos_ = kHeaderSize;
+
+    werkzeugkiste::config::Configuration cfg{};
+    std::string fqn{};
+    ReadGroup(cfg, fqn);
+    if (pos_ != data_.size()) {
+      Fail("unexpected trailing data");
+    }
+    return cfg;
+  }
+
+ private:
+  std::string_view data_{};
+  std::size_t pos_{0};
+  std::size_t depth_{0};
+
+  [[noreturn]] static void Fail(const std::string &reason) {
+    std::string msg{"Invalid binary configuration: "};
+    msg += reason;
+    msg += '!';
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+
+  uint8_t ReadByte() {
+    if (pos_ >= data_.size()) {
+      Fail("unexpected end of data");
+    }
+    return static_cast<uint8_t>(data_[pos_++]);
+  }
+
+  uint64_t ReadVarint() {
+    uint64_t value{0};
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+      const uint8_t byte = ReadByte();
+      value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+      if ((byte & 0x80U) == 0) {
+        return value;
+      }
+    }
+    Fail("invalid varint");
+  }
+
+  int64_t ReadSigned() {
+    const uint64_t uvalue = ReadVarint();
+    return static_cast<int64_t>((uvalue >> 1U) ^ (~(uvalue & 1U) + 1U));
+  }
+
+  double ReadDouble() {
+    uint64_t bits{0};
+    for (std::size_t i = 0; i < 8; ++i) {
+      bits |= static_cast<uint64_t>(ReadByte()) << (8 * i);
+    }
+    double value{};
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string_view ReadString() {
+    const uint64_t len = ReadVarint();
+    if (len > (data_.size() - pos_)) {
+      Fail("string exceeds data");
+    }
+    const std::string_view str = data_.substr(pos_, len);
+    pos_ += len;
+    return str;
+  }
+
+  std::size_t ReadCount() {
+    const uint64_t count = ReadVarint();
+    // Each element requires at least one byte
+    if (count > (data_.size() - pos_)) {
+      Fail("element count exceeds data");
+    }
+    return static_cast<std::size_t>(count);
+  }
+
+  werkzeugkiste::config::date ReadDate() {
+    const uint64_t year = ReadVarint();
+    const uint8_t month = ReadByte();
+    const uint8_t day = ReadByte();
+    return werkzeugkiste::config::date{
+        werkzeugkiste::config::checked_numcast<uint32_t>(year),
+        static_cast<uint32_t>(month),
+        static_cast<uint32_t>(day)};
+  }
+
+  werkzeugkiste::config::time ReadTime() {
+    const uint8_t hour = ReadByte();
+    const uint8_t minute = ReadByte();
+    const uint8_t second = ReadByte();
+    const uint64_t nanosecond = ReadVarint();
+    return werkzeugkiste::config::time{static_cast<uint32_t>(hour),
+        static_cast<uint32_t>(minute),
+        static_cast<uint32_t>(second),
+        werkzeugkiste::config::checked_numcast<uint32_t>(nanosecond)};
+  }
+
+  werkzeugkiste::config::date_time ReadDateTime() {
+    const werkzeugkiste::config::date d = ReadDate();
+    const werkzeugkiste::config::time t = ReadTime();
+    if (ReadByte() == 0) {
+      return werkzeugkiste::config::date_time{d, t};
+    }
+    const int64_t offset = ReadSigned();
+    return werkzeugkiste::config::date_time{d,
+        t,
+        werkzeugkiste::config::time_offset{
+            werkzeugkiste::config::checked_numcast<int32_t>(offset)}};
+  }
+
+  /// @brief Must be called upon entering a group/list to limit the
+  ///   recursion, *i.e.* malformed data must not overflow the stack.
+  void EnterNested() {
+    if (++depth_ > kMaxDepth) {
+      Fail("exceeds the maximum nesting depth of " +
+           std::to_string(kMaxDepth));
+    }
+  }
+
+  Tag ReadTag() {
+    const uint8_t tag = ReadByte();
+    if ((tag < static_cast<uint8_t>(Tag::Boolean)) ||
+        (tag > static_cast<uint8_t>(Tag::Group))) {
+      Fail("unknown type tag " + std::to_string(tag));
+    }
+    return static_cast<Tag>(tag);
+  }
+
+  /// @brief Decodes all parameters of a group into the (existing) group at
+  ///   `fqn`.
+  void ReadGroup(werkzeugkiste::config::Configuration &cfg, std::string &fqn) {
+    EnterNested();
+    const std::size_t prefix_len = fqn.length();
+    const std::size_t num_params = ReadCount();
+    for (std::size_t i = 0; i < num_params; ++i) {
+      const std::string_view key = ReadString();
+      if (prefix_len > 0) {
+        fqn += '.';
+      }
+      fqn += key;
+
+      switch (ReadTag()) {
+        case Tag::Boolean:
+          cfg.SetBool(fqn, ReadByte() != 0);
+          break;
+
+        case Tag::Integer:
+          cfg.SetInt64(fqn, ReadSigned());
+          break;
+
+        case Tag::FloatingPoint:
+          cfg.SetDouble(fqn, ReadDouble());
+          break;
+
+        case Tag::String:
+          cfg.SetString(fqn, std::string{ReadString()});
+          break;
+
+        case Tag::Date:
+          cfg.SetDate(fqn, ReadDate());
+          break;
+
+        case Tag::Time:
+          cfg.SetTime(fqn, ReadTime());
+          break;
+
+        case Tag::DateTime:
+          cfg.SetDateTime(fqn, ReadDateTime());
+          break;
+
+        case Tag::List:
+          cfg.CreateList(fqn);
+          ReadList(cfg, fqn);
+          break;
+
+        case Tag::Group:
+          cfg.SetGroup(fqn, werkzeugkiste::config::Configuration{});
+          ReadGroup(cfg, fqn);
+          break;
+      }
+      fqn.resize(prefix_len);
+    }
+    --depth_;
+  }
+
+  /// @brief Decodes all elements of a list into the (existing, empty) list
+  ///   at `fqn`.
+  void ReadList(werkzeugkiste::config::Configuration &cfg, std::string &fqn) {
+    EnterNested();
+    const std::size_t prefix_len = fqn.length();
+    const std::size_t num_el = ReadCount();
+    for (std::size_t idx = 0; idx < num_el; ++idx) {
+      switch (ReadTag()) {
+        case Tag::Boolean:
+          cfg.Append(fqn, ReadByte() != 0);
+          break;
+
+        case Tag::Integer:
+          cfg.Append(fqn, ReadSigned());
+          break;
+
+        case Tag::FloatingPoint:
+          cfg.Append(fqn, ReadDouble());
+          break;
+
+        case Tag::String:
+          cfg.Append(fqn, std::string{ReadString()});
+          break;
+
+        case Tag::Date:
+          cfg.Append(fqn, ReadDate());
+          break;
+
+        case Tag::Time:
+          cfg.Append(fqn, ReadTime());
+          break;
+
+        case Tag::DateTime:
+          cfg.Append(fqn, ReadDateTime());
+          break;
+
+        case Tag::List:
+          cfg.AppendList(fqn);
+          fqn += '[';
+          fqn += std::to_string(idx);
+          fqn += ']';
+          ReadList(cfg, fqn);
+          fqn.resize(prefix_len);
+          break;
+
+        case Tag::Group:
+          cfg.Append(fqn, werkzeugkiste::config::Configuration{});
+          fqn += '[';
+          fqn += std::to_string(idx);
+          fqn += ']';
+          ReadGroup(cfg, fqn);
+          fqn.resize(prefix_len);
+          break;
+      }
+    }
+    --depth_;
+  }
+};
+}  // namespace binary
+
+/// @brief Encodes the group at `fqn` (empty for the root group).
+inline std::string EncodeBinaryGroup(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string_view fqn) {
+  binary::Writer writer{};
+  writer.WriteRootGroup(cfg, fqn);
+  return writer.Finish();
+}
+
+/// @brief Encodes the list at `fqn` as parameter `wrapper_key` of an
+///   otherwise empty root group.
+inline std::string EncodeBinaryList(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string_view fqn,
+    std::string_view wrapper_key) {
+  binary::Writer writer{};
+  writer.WriteRootList(cfg, fqn, wrapper_key);
+  return writer.Finish();
+}
+
+/// @brief Decodes a configuration from its binary encoding.
+inline werkzeugkiste::config::Configuration DecodeBinary(
+    std::string_view data) {
+  binary::Reader reader{data};
+  return reader.ReadRoot();
+}
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_BINARY_H
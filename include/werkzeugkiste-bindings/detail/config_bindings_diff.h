@@ -0,0 +1,488 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_DIFF_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_DIFF_H
+
+#include <werkzeugkiste/config/configuration.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief Appends the parameter name `key` to the fully qualified name `fqn`.
+inline void AppendParameterName(std::string &fqn, std::string_view key) {
+  if (!fqn.empty()) {
+    fqn += '.';
+  }
+  fqn += key;
+}
+
+/// @brief Appends the list index `idx` to the fully qualified name `fqn`.
+inline void AppendListIndex(std::string &fqn, std::size_t idx) {
+  fqn += '[';
+  fqn += std::to_string(idx);
+  fqn += ']';
+}
+
+/// @brief Copies the list `fqn_src` from `src` to `fqn_dst` in `dst`.
+inline void CopyList(const werkzeugkiste::config::Configuration &src,
+    std::string_view fqn_src,
+    werkzeugkiste::config::Configuration &dst,
+    std::string_view fqn_dst);
+
+/// @brief Appends the list element `fqn_src_elem` of `src` to the list
+///   `fqn_dst` in `dst`.
+inline void AppendListElement(const werkzeugkiste::config::Configuration &src,
+    std::string_view fqn_src_elem,
+    werkzeugkiste::config::Configuration &dst,
+    std::string_view fqn_dst) {
+  switch (src.Type(fqn_src_elem)) {
+    case werkzeugkiste::config::ConfigType::Boolean:
+      dst.Append(fqn_dst, src.GetBool(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::Integer:
+      dst.Append(fqn_dst, src.GetInt64(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::FloatingPoint:
+      dst.Append(fqn_dst, src.GetDouble(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::String:
+      dst.Append(fqn_dst, src.GetString(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::List: {
+      // We need to append a list, then recurse with a
+      // properly adjusted key
+      const std::size_t size_dst = dst.Size(fqn_dst);
+      const std::string fqn_dst_elem =
+          werkzeugkiste::config::Configuration::KeyForListElement(
+            fqn_dst, size_dst);
+      dst.AppendList(fqn_dst);
+      CopyList(src, fqn_src_elem, dst, fqn_dst_elem);
+      break;
+    }
+
+    case werkzeugkiste::config::ConfigType::Group:
+      dst.Append(fqn_dst, src.GetGroup(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::Date:
+      dst.Append(fqn_dst, src.GetDate(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::Time:
+      dst.Append(fqn_dst, src.GetTime(fqn_src_elem));
+      break;
+
+    case werkzeugkiste::config::ConfigType::DateTime:
+      dst.Append(fqn_dst, src.GetDateTime(fqn_src_elem));
+      break;
+  }
+}
+
+inline void CopyList(const werkzeugkiste::config::Configuration &src,
+    std::string_view fqn_src,
+    werkzeugkiste::config::Configuration &dst,
+    std::string_view fqn_dst) {
+  if (!dst.Contains(fqn_dst)) {
+    std::string msg{"CopyList requires that the list parameter `"};
+    msg += fqn_dst;
+    msg += "` already exists!";
+    throw std::logic_error{msg};
+  }
+
+  const std::size_t size_src = src.Size(fqn_src);
+  for (std::size_t idx = 0; idx < size_src; ++idx) {
+    AppendListElement(src,
+        werkzeugkiste::config::Configuration::KeyForListElement(fqn_src, idx),
+        dst,
+        fqn_dst);
+  }
+}
+
+/// @brief Groups which replace list elements, indexed by their position.
+using ListElementReplacements = std::unordered_map<std::size_t,
+    const werkzeugkiste::config::Configuration *>;
+
+/// @brief Replaces the elements of the list `fqn_list` in `cfg` by the
+///   given groups. werkzeugkiste cannot replace a list element by a group,
+///   thus the list is rebuilt once.
+inline void ReplaceListElements(werkzeugkiste::config::Configuration &cfg,
+    std::string_view fqn_list,
+    const ListElementReplacements &replacements) {
+  using namespace std::string_view_literals;
+  werkzeugkiste::config::Configuration copy{};
+  copy.CreateList("list"sv);
+  CopyList(cfg, fqn_list, copy, "list"sv);
+  cfg.ClearList(fqn_list);
+  const std::size_t size = copy.Size("list"sv);
+  for (std::size_t idx = 0; idx < size; ++idx) {
+    const auto it = replacements.find(idx);
+    if (it != replacements.end()) {
+      cfg.Append(fqn_list, *(it->second));
+    } else {
+      AppendListElement(copy,
+          werkzeugkiste::config::Configuration::KeyForListElement(
+              "list"sv, idx),
+          cfg,
+          fqn_list);
+    }
+  }
+}
+
+/// @brief Returns true if parameter `key_a` of `a` and parameter `key_b` of
+///   `b` have the same type and value. Lists and groups are compared
+///   recursively. An empty key denotes the root group.
+///
+/// The key buffers will be extended for nested parameters, but are restored
+/// before returning.
+inline bool ParametersEqual(const werkzeugkiste::config::Configuration &a,
+    std::string &key_a,
+    const werkzeugkiste::config::Configuration &b,
+    std::string &key_b) {
+  using werkzeugkiste::config::ConfigType;
+  const ConfigType type = key_a.empty() ? ConfigType::Group : a.Type(key_a);
+  if (type != (key_b.empty() ? ConfigType::Group : b.Type(key_b))) {
+    return false;
+  }
+
+  switch (type) {
+    case ConfigType::Boolean:
+      return a.GetBool(key_a) == b.GetBool(key_b);
+
+    case ConfigType::Integer:
+      return a.GetInt64(key_a) == b.GetInt64(key_b);
+
+    case ConfigType::FloatingPoint:
+      return a.GetDouble(key_a) == b.GetDouble(key_b);
+
+    case ConfigType::String:
+      return a.GetString(key_a) == b.GetString(key_b);
+
+    case ConfigType::Date:
+      return a.GetDate(key_a) == b.GetDate(key_b);
+
+    case ConfigType::Time:
+      return a.GetTime(key_a) == b.GetTime(key_b);
+
+    case ConfigType::DateTime:
+      return a.GetDateTime(key_a) == b.GetDateTime(key_b);
+
+    case ConfigType::List: {
+      const std::size_t num_el = a.Size(key_a);
+      if (num_el != b.Size(key_b)) {
+        return false;
+      }
+      const std::size_t len_a = key_a.length();
+      const std::size_t len_b = key_b.length();
+      bool equal = true;
+      for (std::size_t idx = 0; equal && (idx < num_el); ++idx) {
+        AppendListIndex(key_a, idx);
+        AppendListIndex(key_b, idx);
+        equal = ParametersEqual(a, key_a, b, key_b);
+        key_a.resize(len_a);
+        key_b.resize(len_b);
+      }
+      return equal;
+    }
+
+    case ConfigType::Group: {
+      const std::vector<std::string> names = a.ListParameterNames(
+          key_a, /*include_array_entries=*/false, /*recursive=*/false);
+      if (names.size() != b.Size(key_b)) {
+        return false;
+      }
+      const std::size_t len_a = key_a.length();
+      const std::size_t len_b = key_b.length();
+      bool equal = true;
+      for (std::size_t idx = 0; equal && (idx < names.size()); ++idx) {
+        AppendParameterName(key_a, names[idx]);
+        AppendParameterName(key_b, names[idx]);
+        equal = b.Contains(key_b) && ParametersEqual(a, key_a, b, key_b);
+        key_a.resize(len_a);
+        key_b.resize(len_b);
+      }
+      return equal;
+    }
+  }
+  return false;  // LCOV_EXCL_LINE
+}
+
+/// @brief Mixes `len` bytes into the 64-bit FNV-1a hash `hash`.
+inline void HashBytes(std::uint64_t &hash, const void *data, std::size_t len) {
+  constexpr std::uint64_t kFnvPrime = 0x100000001b3ULL;
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t idx = 0; idx < len; ++idx) {
+    hash ^= bytes[idx];
+    hash *= kFnvPrime;
+  }
+}
+
+/// @brief Mixes the integral value `value` into the hash `hash`.
+template <typename Tp>
+inline void HashValue(std::uint64_t &hash, Tp value) {
+  const auto converted = static_cast<std::int64_t>(value);
+  HashBytes(hash, &converted, sizeof(converted));
+}
+
+inline void HashString(std::uint64_t &hash, std::string_view str) {
+  HashValue(hash, str.length());
+  HashBytes(hash, str.data(), str.length());
+}
+
+/// @brief Cached fingerprints of groups and lists, indexed by their fully
+///   qualified names. The root group is denoted by an empty key.
+using FingerprintCache = std::map<std::string, std::uint64_t, std::less<>>;
+
+/// @brief Returns the content hash of parameter `key` of `cfg`. An empty key
+///   denotes the root group.
+///
+/// The fingerprint of a group/list is computed from the fingerprints of its
+/// children (*i.e.* a Merkle hash) and will be stored in `cache`. Thus, after
+/// modifying a parameter, only the fingerprints of the modified subtree and
+/// its ancestors must be invalidated, see `InvalidateFingerprints`. Equal
+/// parameters yield the same fingerprint, *i.e.* differing fingerprints imply
+/// that the parameters differ.
+///
+/// The key buffer will be extended for nested parameters, but is restored
+/// before returning.
+inline std::uint64_t ParameterFingerprint(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string &key,
+    FingerprintCache &cache) {
+  using werkzeugkiste::config::ConfigType;
+  const ConfigType type = key.empty() ? ConfigType::Group : cfg.Type(key);
+  if ((type == ConfigType::Group) || (type == ConfigType::List)) {
+    const auto it = cache.find(key);
+    if (it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  HashValue(hash, static_cast<unsigned char>(type));
+  switch (type) {
+    case ConfigType::Boolean:
+      HashValue(hash, cfg.GetBool(key));
+      break;
+
+    case ConfigType::Integer:
+      HashValue(hash, cfg.GetInt64(key));
+      break;
+
+    case ConfigType::FloatingPoint: {
+      // Both zeros compare equal, thus they must have the same fingerprint.
+      const double value = cfg.GetDouble(key);
+      const double normalized = (value == 0.0) ? 0.0 : value;
+      HashBytes(hash, &normalized, sizeof(normalized));
+      break;
+    }
+
+    case ConfigType::String:
+      HashString(hash, cfg.GetString(key));
+      break;
+
+    case ConfigType::Date: {
+      const auto date = cfg.GetDate(key);
+      HashValue(hash, date.year);
+      HashValue(hash, date.month);
+      HashValue(hash, date.day);
+      break;
+    }
+
+    case ConfigType::Time: {
+      const auto time = cfg.GetTime(key);
+      HashValue(hash, time.hour);
+      HashValue(hash, time.minute);
+      HashValue(hash, time.second);
+      HashValue(hash, time.nanosecond);
+      break;
+    }
+
+    case ConfigType::DateTime: {
+      const auto dt = cfg.GetDateTime(key);
+      HashValue(hash, dt.date.year);
+      HashValue(hash, dt.date.month);
+      HashValue(hash, dt.date.day);
+      HashValue(hash, dt.time.hour);
+      HashValue(hash, dt.time.minute);
+      HashValue(hash, dt.time.second);
+      HashValue(hash, dt.time.nanosecond);
+      HashValue(hash, dt.IsLocal());
+      if (!dt.IsLocal()) {
+        HashValue(hash, dt.offset.value().minutes);
+      }
+      break;
+    }
+
+    case ConfigType::List: {
+      const std::size_t num_el = cfg.Size(key);
+      const std::size_t len = key.length();
+      HashValue(hash, num_el);
+      for (std::size_t idx = 0; idx < num_el; ++idx) {
+        AppendListIndex(key, idx);
+        HashValue(hash, ParameterFingerprint(cfg, key, cache));
+        key.resize(len);
+      }
+      cache.emplace(key, hash);
+      break;
+    }
+
+    case ConfigType::Group: {
+      const std::vector<std::string> names = cfg.ListParameterNames(
+          key, /*include_array_entries=*/false, /*recursive=*/false);
+      const std::size_t len = key.length();
+      HashValue(hash, names.size());
+      for (const std::string &name : names) {
+        HashString(hash, name);
+        AppendParameterName(key, name);
+        HashValue(hash, ParameterFingerprint(cfg, key, cache));
+        key.resize(len);
+      }
+      cache.emplace(key, hash);
+      break;
+    }
+  }
+  return hash;
+}
+
+/// @brief Removes the cached fingerprints of parameter `key`, its children
+///   and all of its ancestors after it has been modified.
+inline void InvalidateFingerprints(FingerprintCache &cache,
+    std::string_view key) {
+  if (key.empty()) {
+    cache.clear();
+    return;
+  }
+
+  // All cached names which start with `key` are stored contiguously.
+  auto it = cache.lower_bound(key);
+  while ((it != cache.end()) &&
+         (it->first.compare(0, key.length(), key) == 0)) {
+    const std::string &name = it->first;
+    if ((name.length() == key.length()) || (name[key.length()] == '.') ||
+        (name[key.length()] == '[')) {
+      it = cache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  for (std::size_t pos = 0; pos < key.length(); ++pos) {
+    if ((key[pos] == '.') || (key[pos] == '[')) {
+      const auto ancestor = cache.find(key.substr(0, pos));
+      if (ancestor != cache.end()) {
+        cache.erase(ancestor);
+      }
+    }
+  }
+  cache.erase(std::string{});
+}
+
+/// @brief Fully qualified names of the parameters which differ between two
+///   configurations.
+struct ParameterDiff {
+  /// @brief Parameters which only exist in the second configuration.
+  std::vector<std::string> added{};
+
+  /// @brief Parameters which only exist in the first configuration.
+  std::vector<std::string> removed{};
+
+  /// @brief Parameters which exist in both, but differ in type or value.
+  ///   Lists are compared as a whole.
+  std::vector<std::string> changed{};
+
+  bool Empty() const {
+    return added.empty() && removed.empty() && changed.empty();
+  }
+};
+
+/// @brief Compares the groups `key_prev` of `prev` and `key_curr` of `curr`
+///   recursively. The reported parameter names are relative to these groups,
+///   *i.e.* `rel` holds the relative name of the currently compared group.
+///   All key buffers will be restored before returning.
+inline void CollectParameterDiff(
+    const werkzeugkiste::config::Configuration &prev,
+    std::string &key_prev,
+    const werkzeugkiste::config::Configuration &curr,
+    std::string &key_curr,
+    std::string &rel,
+    ParameterDiff &diff) {
+  using werkzeugkiste::config::ConfigType;
+  const std::size_t len_prev = key_prev.length();
+  const std::size_t len_curr = key_curr.length();
+  const std::size_t len_rel = rel.length();
+  const auto append = [&key_prev, &key_curr, &rel](const std::string &name) {
+    AppendParameterName(key_prev, name);
+    AppendParameterName(key_curr, name);
+    AppendParameterName(rel, name);
+  };
+  const auto restore = [&]() {
+    key_prev.resize(len_prev);
+    key_curr.resize(len_curr);
+    rel.resize(len_rel);
+  };
+
+  for (const std::string &name : prev.ListParameterNames(
+           key_prev, /*include_array_entries=*/false, /*recursive=*/false)) {
+    append(name);
+    if (!curr.Contains(key_curr)) {
+      diff.removed.push_back(rel);
+    } else if ((prev.Type(key_prev) == ConfigType::Group) &&
+               (curr.Type(key_curr) == ConfigType::Group)) {
+      CollectParameterDiff(prev, key_prev, curr, key_curr, rel, diff);
+    } else if (!ParametersEqual(prev, key_prev, curr, key_curr)) {
+      diff.changed.push_back(rel);
+    }
+    restore();
+  }
+
+  for (const std::string &name : curr.ListParameterNames(
+           key_curr, /*include_array_entries=*/false, /*recursive=*/false)) {
+    append(name);
+    if (!prev.Contains(key_prev)) {
+      diff.added.push_back(rel);
+    }
+    restore();
+  }
+}
+
+/// @brief Returns the (sorted) parameters which differ between the group
+///   `fqn_prev` of `prev` and the group `fqn_curr` of `curr`. The parameter
+///   names are relative to these groups. An empty key denotes the root group.
+inline ParameterDiff ComputeParameterDiff(
+    const werkzeugkiste::config::Configuration &prev,
+    std::string_view fqn_prev,
+    const werkzeugkiste::config::Configuration &curr,
+    std::string_view fqn_curr) {
+  ParameterDiff diff{};
+  std::string key_prev{fqn_prev};
+  std::string key_curr{fqn_curr};
+  std::string rel{};
+  CollectParameterDiff(prev, key_prev, curr, key_curr, rel, diff);
+  std::sort(diff.added.begin(), diff.added.end());
+  std::sort(diff.removed.begin(), diff.removed.end());
+  std::sort(diff.changed.begin(), diff.changed.end());
+  return diff;
+}
+
+/// @brief Returns the (sorted) parameters which differ between `prev` and
+///   `curr`.
+inline ParameterDiff ComputeParameterDiff(
+    const werkzeugkiste::config::Configuration &prev,
+    const werkzeugkiste::config::Configuration &curr) {
+  using namespace std::string_view_literals;
+  return ComputeParameterDiff(prev, ""sv, curr, ""sv);
+}
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_DIFF_H
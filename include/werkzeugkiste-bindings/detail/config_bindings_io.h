@@ -0,0 +1,771 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_IO_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_IO_H
+
+#include <werkzeugkiste-bindings/detail/config_bindings_yaml.h>
+#include <werkzeugkiste/config/configuration.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PYZEUGKISTE_HAS_MMAP
+#endif
+
+#ifdef pyzeugkiste_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief Read-only contents of a file, either memory-mapped or read into
+///   a string.
+///
+/// Memory-mapping is only available on POSIX systems. On other platforms,
+/// `Map` falls back to reading the file.
+class FileBuffer {
+ public:
+  /// @brief Maps the file into memory.
+  ///
+  /// The pages will be loaded on demand, *i.e.* the parser can directly
+  /// operate on the mapped memory without an intermediate copy.
+  static FileBuffer Map(const std::string &filename) {
+#ifdef PYZEUGKISTE_HAS_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+      ThrowOpenError(filename);
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      ThrowOpenError(filename);
+    }
+
+    FileBuffer buffer{};
+    buffer.size_ = static_cast<std::size_t>(st.st_size);
+    if (buffer.size_ > 0) {
+      void *addr =
+          ::mmap(nullptr, buffer.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED) {
+        ::close(fd);
+        ThrowOpenError(filename);
+      }
+      ::madvise(addr, buffer.size_, MADV_SEQUENTIAL);
+      buffer.mapped_ = addr;
+    }
+    // The mapping stays valid after closing the file descriptor.
+    ::close(fd);
+    return buffer;
+#else   // PYZEUGKISTE_HAS_MMAP
+    return Read(filename);
+#endif  // PYZEUGKISTE_HAS_MMAP
+  }
+
+  /// @brief Reads the full file into memory.
+  static FileBuffer Read(const std::string &filename) {
+    std::ifstream stream{filename, std::ios::in | std::ios::binary};
+    if (!stream.is_open()) {
+      ThrowOpenError(filename);
+    }
+
+    FileBuffer buffer{};
+    stream.seekg(0, std::ios::end);
+    buffer.contents_.resize(static_cast<std::size_t>(stream.tellg()));
+    stream.seekg(0, std::ios::beg);
+    stream.read(buffer.contents_.data(),
+        static_cast<std::streamsize>(buffer.contents_.size()));
+    if (!stream) {
+      ThrowOpenError(filename);
+    }
+    buffer.size_ = buffer.contents_.size();
+    return buffer;
+  }
+
+  /// @brief Returns true if the file starts with the gzip magic bytes.
+  static bool IsGzipCompressed(const std::string &filename) {
+    std::ifstream stream{filename, std::ios::in | std::ios::binary};
+    char magic[2]{};
+    return stream.read(magic, sizeof(magic)) &&
+           (static_cast<unsigned char>(magic[0]) == 0x1FU) &&
+           (static_cast<unsigned char>(magic[1]) == 0x8BU);
+  }
+
+  /// @brief Decompresses a gzip-compressed file.
+  ///
+  /// The file is read and decompressed chunk by chunk, *i.e.* only the
+  /// decompressed contents will be held in memory. Concatenated gzip
+  /// members are supported.
+  static FileBuffer Inflate(const std::string &filename) {
+#ifdef pyzeugkiste_WITH_ZLIB
+    constexpr std::size_t kChunkSize = 64 * 1024;
+    std::ifstream stream{filename, std::ios::in | std::ios::binary};
+    if (!stream.is_open()) {
+      ThrowOpenError(filename);
+    }
+
+    z_stream zs{};
+    // Adding 16 to the window bits selects the gzip format.
+    if (inflateInit2(&zs, 16 + MAX_WBITS) != Z_OK) {
+      throw std::runtime_error{"Cannot initialize zlib!"};
+    }
+    const std::unique_ptr<z_stream, decltype(&inflateEnd)> guard{
+        &zs, &inflateEnd};
+
+    FileBuffer buffer{};
+    std::vector<char> chunk(kChunkSize);
+    bool member_end = false;
+    while (stream.read(chunk.data(), static_cast<std::streamsize>(kChunkSize)) ||
+           (stream.gcount() > 0)) {
+      zs.next_in = reinterpret_cast<Bytef *>(chunk.data());
+      zs.avail_in = static_cast<uInt>(stream.gcount());
+
+      while (true) {
+        if (member_end) {
+          if (zs.avail_in == 0) {
+            break;
+          }
+          // The input continues with the next gzip member.
+          inflateReset(&zs);
+          member_end = false;
+        }
+
+        const std::size_t offset = buffer.contents_.size();
+        buffer.contents_.resize(offset + kChunkSize);
+        zs.next_out = reinterpret_cast<Bytef *>(&buffer.contents_[offset]);
+        zs.avail_out = static_cast<uInt>(kChunkSize);
+        const int ret = inflate(&zs, Z_NO_FLUSH);
+        const bool output_full = (zs.avail_out == 0);
+        buffer.contents_.resize(offset + kChunkSize - zs.avail_out);
+
+        if (ret == Z_STREAM_END) {
+          member_end = true;
+        } else if (ret == Z_BUF_ERROR) {
+          // No progress possible without further input.
+          break;
+        } else if (ret != Z_OK) {
+          ThrowInflateError(filename, (zs.msg != nullptr) ? zs.msg : "");
+        } else if ((zs.avail_in == 0) && !output_full) {
+          break;
+        }
+      }
+    }
+
+    if (!member_end) {
+      ThrowInflateError(filename, "unexpected end of file");
+    }
+    buffer.size_ = buffer.contents_.size();
+    return buffer;
+#else   // pyzeugkiste_WITH_ZLIB
+    (void)filename;
+    throw std::runtime_error{
+        "Loading gzip-compressed configuration files requires zlib, which "
+        "was not available when pyzeugkiste was built!"};
+#endif  // pyzeugkiste_WITH_ZLIB
+  }
+
+  FileBuffer() = default;
+
+  ~FileBuffer() { Unmap(); }
+
+  FileBuffer(const FileBuffer &) = delete;
+  FileBuffer &operator=(const FileBuffer &) = delete;
+
+  FileBuffer(FileBuffer &&other) noexcept
+      : mapped_{std::exchange(other.mapped_, nullptr)},
+        size_{std::exchange(other.size_, 0)},
+        contents_{std::move(other.contents_)} {}
+
+  FileBuffer &operator=(FileBuffer &&other) noexcept {
+    if (this != &other) {
+      Unmap();
+      mapped_ = std::exchange(other.mapped_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      contents_ = std::move(other.contents_);
+    }
+    return *this;
+  }
+
+  /// @brief Returns a view on the file contents, valid as long as this
+  ///   buffer exists.
+  std::string_view View() const {
+    if (mapped_ != nullptr) {
+      return std::string_view{static_cast<const char *>(mapped_), size_};
+    }
+    return std::string_view{contents_};
+  }
+
+  std::size_t Size() const { return size_; }
+
+  bool IsMapped() const { return mapped_ != nullptr; }
+
+ private:
+  void *mapped_{nullptr};
+  std::size_t size_{0};
+  std::string contents_{};
+
+  void Unmap() {
+#ifdef PYZEUGKISTE_HAS_MMAP
+    if (mapped_ != nullptr) {
+      ::munmap(mapped_, size_);
+    }
+#endif  // PYZEUGKISTE_HAS_MMAP
+    mapped_ = nullptr;
+  }
+
+  [[noreturn]] static void ThrowOpenError(const std::string &filename) {
+    std::string msg{"Cannot open file `"};
+    msg += filename;
+    msg += "` for reading!";
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+
+  [[noreturn]] static void ThrowInflateError(const std::string &filename,
+      std::string_view reason) {
+    std::string msg{"Cannot decompress file `"};
+    msg += filename;
+    msg += '`';
+    if (!reason.empty()) {
+      msg += ": ";
+      msg += reason;
+    }
+    msg += '!';
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+};
+
+/// @brief Parses the string contents of `filename` via `parse` and prefixes
+///   parsing errors with the file name.
+template <typename Parser>
+werkzeugkiste::config::Configuration ParseFileBuffer(
+    const std::string &filename,
+    const FileBuffer &buffer,
+    Parser &&parse) {
+  try {
+    return parse(buffer.View());
+  } catch (const werkzeugkiste::config::ParseError &e) {
+    std::string msg{"Error while parsing `"};
+    msg += filename;
+    msg += "`: ";
+    msg += e.what();
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+}
+
+/// @brief Loads a configuration file via `load_file`.
+///
+/// Gzip-compressed files are detected by their magic bytes. They will be
+/// decompressed and parsed via `parse`. Otherwise, if `use_mmap` is set,
+/// the file will be memory-mapped and parsed via `parse`.
+template <typename FileLoader, typename StringParser>
+werkzeugkiste::config::Configuration LoadConfigFile(const std::string &filename,
+    bool use_mmap,
+    FileLoader &&load_file,
+    StringParser &&parse) {
+  if (FileBuffer::IsGzipCompressed(filename)) {
+    const FileBuffer buffer = FileBuffer::Inflate(filename);
+    return ParseFileBuffer(filename, buffer, std::forward<StringParser>(parse));
+  }
+  if (use_mmap) {
+    const FileBuffer buffer = FileBuffer::Map(filename);
+    return ParseFileBuffer(filename, buffer, std::forward<StringParser>(parse));
+  }
+  return load_file(filename);
+}
+
+/// @brief Loads a YAML configuration file, see `LoadYAMLString`.
+inline werkzeugkiste::config::Configuration LoadYAMLFile(
+    const std::string &filename,
+    werkzeugkiste::config::NullValuePolicy none_policy,
+    bool use_mmap) {
+  const auto parse = [none_policy](std::string_view yaml_str) {
+    return LoadYAMLString(yaml_str, none_policy);
+  };
+  return LoadConfigFile(
+      filename,
+      use_mmap,
+      [&parse](const std::string &fname) {
+        const FileBuffer buffer = FileBuffer::Read(fname);
+        return ParseFileBuffer(fname, buffer, parse);
+      },
+      parse);
+}
+
+/// @brief Returns the lower case extension of the configuration file. For
+///   gzip-compressed files, this is the extension preceding `.gz`.
+inline std::string ConfigFileExtension(const std::string &filename) {
+  const auto lowercase_extension = [](const std::filesystem::path &p) {
+    std::string ext = p.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](char c) {
+      return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+    return ext;
+  };
+  const std::filesystem::path path{filename};
+  const std::string ext = lowercase_extension(path);
+  if (ext == ".gz") {
+    return lowercase_extension(path.stem());
+  }
+  return ext;
+}
+
+/// @brief Loads a configuration file and deduces its type from the file
+///   extension, similar to `werkzeugkiste::config::LoadFile`.
+///
+/// Additionally, YAML (`.yaml` or `.yml`) and gzip-compressed files are
+/// supported. The type of the latter will be deduced from the extension
+/// preceding `.gz`, *e.g.* `config.json.gz`.
+inline werkzeugkiste::config::Configuration LoadConfigFileByExtension(
+    const std::string &filename) {
+  const std::string ext = ConfigFileExtension(filename);
+  if ((ext == ".yaml") || (ext == ".yml")) {
+    return LoadYAMLFile(filename,
+        werkzeugkiste::config::NullValuePolicy::Skip,
+        /*use_mmap=*/false);
+  }
+
+  return LoadConfigFile(
+      filename,
+      /*use_mmap=*/false,
+      [](const std::string &fname) {
+        return werkzeugkiste::config::LoadFile(fname);
+      },
+      [&filename, &ext](std::string_view contents) {
+        if (ext == ".toml") {
+          return werkzeugkiste::config::LoadTOMLString(contents);
+        }
+        if (ext == ".json") {
+          return werkzeugkiste::config::LoadJSONString(
+              contents, werkzeugkiste::config::NullValuePolicy::Skip);
+        }
+        if (ext == ".cfg") {
+          return werkzeugkiste::config::LoadLibconfigString(contents);
+        }
+
+        std::string msg{"Cannot deduce the configuration type from the "
+                        "extension of `"};
+        msg += filename;
+        msg += "`!";
+        throw werkzeugkiste::config::ParseError{msg};
+      });
+}
+
+/// @brief Chunk size for writing serialized configurations.
+constexpr std::size_t kWriteChunkSize = 1024 * 1024;
+
+/// @brief Writes `contents` to `filename` chunk by chunk. If `compress` is
+///   set, the file will be gzip-compressed.
+///
+/// Returns 0 upon success, or the `errno` value otherwise. This allows the
+/// caller to raise the corresponding python `OSError`.
+inline int WriteFileChunked(const std::string &filename,
+    std::string_view contents,
+    bool compress) {
+  if (compress) {
+#ifdef pyzeugkiste_WITH_ZLIB
+    errno = 0;
+    gzFile file = gzopen(filename.c_str(), "wb");
+    if (file == nullptr) {
+      return (errno != 0) ? errno : ENOMEM;
+    }
+    int error = 0;
+    for (std::size_t offset = 0; offset < contents.length();
+         offset += kWriteChunkSize) {
+      const std::size_t len =
+          std::min(kWriteChunkSize, contents.length() - offset);
+      if (gzwrite(file, contents.data() + offset, static_cast<unsigned>(len)) !=
+          static_cast<int>(len)) {
+        error = (errno != 0) ? errno : EIO;
+        break;
+      }
+    }
+    if ((gzclose(file) != Z_OK) && (error == 0)) {
+      error = (errno != 0) ? errno : EIO;
+    }
+    return error;
+#else   // pyzeugkiste_WITH_ZLIB
+    throw std::runtime_error{
+        "Writing gzip-compressed configuration files requires zlib, which "
+        "was not available when pyzeugkiste was built!"};
+#endif  // pyzeugkiste_WITH_ZLIB
+  }
+
+  std::FILE *file = std::fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    return errno;
+  }
+  int error = 0;
+  for (std::size_t offset = 0; offset < contents.length();
+       offset += kWriteChunkSize) {
+    const std::size_t len =
+        std::min(kWriteChunkSize, contents.length() - offset);
+    if (std::fwrite(contents.data() + offset, 1, len, file) != len) {
+      error = errno;
+      break;
+    }
+  }
+  if ((std::fclose(file) != 0) && (error == 0)) {
+    error = errno;
+  }
+  return error;
+}
+
+/// @brief Reads a JSON lines (NDJSON) file record by record.
+///
+/// The file is read in fixed-size chunks, thus the memory usage is bounded by
+/// the chunk size, the longest line and the number of prefetched records.
+/// If prefetching is enabled, a background thread parses up to `prefetch`
+/// records ahead of the consumer.
+///
+/// `Next` does not require the GIL and should be called without it.
+class JSONLinesReader {
+ public:
+  JSONLinesReader(const std::string &filename,
+      werkzeugkiste::config::NullValuePolicy none_policy,
+      std::size_t prefetch)
+      : filename_{filename},
+        stream_{filename, std::ios::in | std::ios::binary},
+        none_policy_{none_policy},
+        prefetch_{prefetch} {
+    if (!stream_.is_open()) {
+      std::string msg{"Cannot open file `"};
+      msg += filename;
+      msg += "` for reading!";
+      throw werkzeugkiste::config::ParseError{msg};
+    }
+    chunk_.resize(kChunkSize);
+
+    if (prefetch_ > 0) {
+      worker_ = std::thread{&JSONLinesReader::Prefetch, this};
+    }
+  }
+
+  ~JSONLinesReader() {
+    if (worker_.joinable()) {
+      {
+        const std::lock_guard<std::mutex> lock{queue_mutex_};
+        stop_ = true;
+      }
+      queue_cv_.notify_all();
+      worker_.join();
+    }
+  }
+
+  JSONLinesReader(const JSONLinesReader &) = delete;
+  JSONLinesReader &operator=(const JSONLinesReader &) = delete;
+  JSONLinesReader(JSONLinesReader &&) = delete;
+  JSONLinesReader &operator=(JSONLinesReader &&) = delete;
+
+  /// @brief Returns the next record or `std::nullopt` if the end of the file
+  ///   has been reached. Parsing errors are reported as `ParseError`.
+  std::optional<werkzeugkiste::config::Configuration> Next() {
+    if (prefetch_ == 0) {
+      const std::lock_guard<std::mutex> lock{read_mutex_};
+      return ParseNext();
+    }
+
+    std::unique_lock<std::mutex> lock{queue_mutex_};
+    queue_cv_.wait(lock, [this]() { return !queue_.empty() || finished_; });
+    if (queue_.empty()) {
+      return std::nullopt;
+    }
+    Record record = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    queue_cv_.notify_all();
+
+    if (record.error) {
+      std::rethrow_exception(record.error);
+    }
+    return std::move(record.cfg);
+  }
+
+ private:
+  static constexpr std::size_t kChunkSize = 1 << 16;
+
+  struct Record {
+    std::optional<werkzeugkiste::config::Configuration> cfg{};
+    std::exception_ptr error{};
+  };
+
+  std::string filename_{};
+  std::ifstream stream_{};
+  werkzeugkiste::config::NullValuePolicy none_policy_{};
+  std::size_t prefetch_{0};
+
+  std::vector<char> chunk_{};
+  std::size_t chunk_pos_{0};
+  std::size_t chunk_end_{0};
+  std::size_t line_number_{0};
+  std::string line_{};
+  std::mutex read_mutex_{};
+
+  std::thread worker_{};
+  std::mutex queue_mutex_{};
+  std::condition_variable queue_cv_{};
+  std::deque<Record> queue_{};
+  bool stop_{false};
+  bool finished_{false};
+
+  /// @brief Reads the next line (without the line break) into `line_`.
+  ///   Returns false at the end of the file.
+  bool ReadLine() {
+    line_.clear();
+    bool has_data = false;
+    while (true) {
+      if (chunk_pos_ >= chunk_end_) {
+        stream_.read(chunk_.data(), static_cast<std::streamsize>(chunk_.size()));
+        chunk_end_ = static_cast<std::size_t>(stream_.gcount());
+        chunk_pos_ = 0;
+        if (chunk_end_ == 0) {
+          break;
+        }
+      }
+
+      has_data = true;
+      const char *begin = chunk_.data() + chunk_pos_;
+      const std::size_t available = chunk_end_ - chunk_pos_;
+      const auto *newline =
+          static_cast<const char *>(std::memchr(begin, '\n', available));
+      if (newline != nullptr) {
+        const auto len = static_cast<std::size_t>(newline - begin);
+        line_.append(begin, len);
+        chunk_pos_ += len + 1;
+        break;
+      }
+      line_.append(begin, available);
+      chunk_pos_ = chunk_end_;
+    }
+
+    if (!has_data) {
+      return false;
+    }
+
+    ++line_number_;
+    if (!line_.empty() && (line_.back() == '\r')) {
+      line_.pop_back();
+    }
+    return true;
+  }
+
+  static bool IsBlank(std::string_view line) {
+    return line.find_first_not_of(" \t\r\f\v") == std::string_view::npos;
+  }
+
+  std::optional<werkzeugkiste::config::Configuration> ParseNext() {
+    while (ReadLine()) {
+      if (IsBlank(line_)) {
+        continue;
+      }
+
+      try {
+        return werkzeugkiste::config::LoadJSONString(line_, none_policy_);
+      } catch (const werkzeugkiste::config::ParseError &e) {
+        std::string msg{"Error while parsing line "};
+        msg += std::to_string(line_number_);
+        msg += " of `";
+        msg += filename_;
+        msg += "`: ";
+        msg += e.what();
+        throw werkzeugkiste::config::ParseError{msg};
+      }
+    }
+    return std::nullopt;
+  }
+
+  void Prefetch() {
+    while (true) {
+      Record record{};
+      try {
+        record.cfg = ParseNext();
+        if (!record.cfg.has_value()) {
+          break;
+        }
+      } catch (...) {
+        record.error = std::current_exception();
+      }
+
+      std::unique_lock<std::mutex> lock{queue_mutex_};
+      queue_cv_.wait(
+          lock, [this]() { return stop_ || (queue_.size() < prefetch_); });
+      if (stop_) {
+        return;
+      }
+      queue_.emplace_back(std::move(record));
+      lock.unlock();
+      queue_cv_.notify_all();
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock{queue_mutex_};
+      finished_ = true;
+    }
+    queue_cv_.notify_all();
+  }
+};
+
+/// @brief Process-wide LRU cache of parsed configuration files.
+///
+/// Entries are keyed by the canonical file path and validated against the
+/// file's modification time and size upon each lookup.
+class ParsedFileCache {
+ public:
+  struct Stats {
+    std::size_t hits{0};
+    std::size_t misses{0};
+    std::size_t entries{0};
+    std::size_t limit{0};
+  };
+
+  static ParsedFileCache &Instance() {
+    static ParsedFileCache cache{};
+    return cache;
+  }
+
+  /// @brief Returns the cached configuration or parses the file via
+  ///   `load(filename)` and caches the result.
+  ///
+  /// Parsing is performed without holding the cache lock, thus concurrent
+  /// lookups are not blocked by a slow parse.
+  template <typename Loader>
+  std::shared_ptr<const werkzeugkiste::config::Configuration> Load(
+      const std::string &filename,
+      Loader &&load) {
+    std::optional<Fingerprint> fp = FileFingerprint(filename);
+    if (!fp.has_value()) {
+      // Let the loader report the actual error (e.g. file not found).
+      return std::make_shared<const werkzeugkiste::config::Configuration>(
+          load(filename));
+    }
+
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      auto it = lookup_.find(fp->path);
+      if (it != lookup_.end()) {
+        if ((it->second->mtime == fp->mtime) && (it->second->size == fp->size)) {
+          ++hits_;
+          lru_.splice(lru_.begin(), lru_, it->second);
+          return it->second->data;
+        }
+        // Outdated entry
+        lru_.erase(it->second);
+        lookup_.erase(it);
+      }
+      ++misses_;
+    }
+
+    auto data = std::make_shared<const werkzeugkiste::config::Configuration>(
+        load(filename));
+
+    const std::lock_guard<std::mutex> lock{mutex_};
+    if (limit_ > 0) {
+      auto it = lookup_.find(fp->path);
+      if (it != lookup_.end()) {
+        lru_.erase(it->second);
+        lookup_.erase(it);
+      }
+      lru_.push_front(Entry{fp->path, fp->mtime, fp->size, data});
+      lookup_[fp->path] = lru_.begin();
+      Evict();
+    }
+    return data;
+  }
+
+  /// @brief Sets the maximum number of cached files. A limit of 0 disables
+  ///   caching.
+  void SetLimit(std::size_t limit) {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    limit_ = limit;
+    Evict();
+  }
+
+  void Clear() {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    lru_.clear();
+    lookup_.clear();
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+  Stats GetStats() const {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    return Stats{hits_, misses_, lru_.size(), limit_};
+  }
+
+ private:
+  struct Fingerprint {
+    std::string path{};
+    std::filesystem::file_time_type::rep mtime{};
+    std::uintmax_t size{};
+  };
+
+  struct Entry {
+    std::string path{};
+    std::filesystem::file_time_type::rep mtime{};
+    std::uintmax_t size{};
+    std::shared_ptr<const werkzeugkiste::config::Configuration> data{};
+  };
+
+  mutable std::mutex mutex_{};
+  std::list<Entry> lru_{};
+  std::unordered_map<std::string, std::list<Entry>::iterator> lookup_{};
+  std::size_t limit_{64};
+  std::size_t hits_{0};
+  std::size_t misses_{0};
+
+  ParsedFileCache() = default;
+
+  void Evict() {
+    while (lru_.size() > limit_) {
+      lookup_.erase(lru_.back().path);
+      lru_.pop_back();
+    }
+  }
+
+  static std::optional<Fingerprint> FileFingerprint(
+      const std::string &filename) {
+    std::error_code ec{};
+    Fingerprint fp{};
+    fp.path = std::filesystem::canonical(filename, ec).string();
+    if (ec) {
+      return std::nullopt;
+    }
+    fp.mtime = std::filesystem::last_write_time(fp.path, ec)
+                   .time_since_epoch()
+                   .count();
+    if (ec) {
+      return std::nullopt;
+    }
+    fp.size = std::filesystem::file_size(fp.path, ec);
+    if (ec) {
+      return std::nullopt;
+    }
+    return fp;
+  }
+};
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_IO_H
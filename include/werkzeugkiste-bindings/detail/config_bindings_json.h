@@ -0,0 +1,292 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_JSON_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_JSON_H
+
+#include <werkzeugkiste/config/configuration.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief JSON serialization which reads the parameters directly from the
+///   configuration tree, *i.e.* a (sub-)group or list can be serialized
+///   without copying it into a separate configuration first.
+///
+/// The output must match werkzeugkiste's `ToJSON`, which is used for the root
+/// configuration: The structure is indented by 4 spaces per level, values are
+/// separated from their keys by " : ". All formatting choices which are not
+/// obvious from the JSON specification are left to werkzeugkiste:
+/// * Finite floating point numbers are written in the same representation
+///   as werkzeugkiste's (either the shortest or a 17-digit one), which is
+///   queried once, see `ShortestDoubleRepresentation`.
+/// * Non-finite numbers, dates/times and strings which contain characters other than printable
+///   ASCII are formatted by werkzeugkiste itself, via a temporary
+///   configuration which only holds this single value.
+namespace json {
+/// @brief Returns the JSON representation of the parameter "v" of `single`,
+///   as written by werkzeugkiste.
+inline std::string ReferenceValue(
+    const werkzeugkiste::config::Configuration &single) {
+  const std::string json = single.ToJSON();
+  std::size_t start = json.find(':', json.find("\"v\"") + 3) + 1;
+  start = json.find_first_not_of(" \t\r\n", start);
+  const std::size_t end = json.find_last_not_of(" \t\r\n}") + 1;
+  return json.substr(start, end - start);
+}
+
+/// @brief Returns true if werkzeugkiste writes floating point numbers in
+///   their shortest round-trip representation, false if it uses 17
+///   significant digits (which depends on the standard library it has been
+///   built with).
+inline bool ShortestDoubleRepresentation() {
+  static const bool shortest = []() {
+    using namespace std::string_view_literals;
+    werkzeugkiste::config::Configuration single{};
+    single.SetDouble("v"sv, 0.1);
+    return ReferenceValue(single) == "0.1";
+  }();
+  return shortest;
+}
+
+class Writer {
+ public:
+  /// @brief Serializes the group at `fqn` as the root object.
+  void WriteRootGroup(const werkzeugkiste::config::Configuration &cfg,
+      std::string_view fqn) {
+    std::string key{fqn};
+    WriteGroup(cfg, key);
+  }
+
+  /// @brief Serializes the list at `fqn` as the single parameter
+  ///   `wrapper_key` of the root object (as the other serializers do for
+  ///   list views).
+  void WriteRootList(const werkzeugkiste::config::Configuration &cfg,
+      std::string_view fqn,
+      std::string_view wrapper_key) {
+    buffer_ += '{';
+    ++depth_;
+    NewLine();
+    WriteString(wrapper_key);
+    buffer_ += " : ";
+    std::string key{fqn};
+    WriteList(cfg, key);
+    --depth_;
+    NewLine();
+    buffer_ += '}';
+  }
+
+  /// @brief Returns the serialized output.
+  std::string Finish() { return std::move(buffer_); }
+
+ private:
+  std::string buffer_{};
+  std::size_t depth_{0};
+
+  void NewLine() {
+    buffer_ += '\n';
+    buffer_.append(4 * depth_, ' ');
+  }
+
+  void WriteString(std::string_view str) {
+    const bool printable_ascii =
+        std::all_of(str.begin(), str.end(), [](char c) -> bool {
+          const auto byte = static_cast<unsigned char>(c);
+          return (byte >= 0x20U) && (byte < 0x7FU);
+        });
+    if (!printable_ascii) {
+      // Escaping of control and non-ASCII characters is left to
+      // werkzeugkiste.
+      WriteReference([str](werkzeugkiste::config::Configuration &single,
+                         std::string_view key) { single.SetString(key, str); });
+      return;
+    }
+
+    buffer_ += '"';
+    for (const char c : str) {
+      if ((c == '"') || (c == '\\')) {
+        buffer_ += '\\';
+      }
+      buffer_ += c;
+    }
+    buffer_ += '"';
+  }
+
+  /// @brief Writes werkzeugkiste's representation of a single value, which
+  ///   `set` stores in a temporary configuration.
+  template <typename Setter>
+  void WriteReference(Setter &&set) {
+    using namespace std::string_view_literals;
+    werkzeugkiste::config::Configuration single{};
+    set(single, "v"sv);
+    buffer_ += ReferenceValue(single);
+  }
+
+  void WriteInteger(int64_t value) {
+    char buf[24];
+    const auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    buffer_.append(buf, res.ptr);
+  }
+
+  void WriteDouble(double value) {
+    if (!std::isfinite(value)) {
+      WriteReference([value](werkzeugkiste::config::Configuration &single,
+                         std::string_view key) {
+        single.SetDouble(key, value);
+      });
+      return;
+    }
+
+    char buf[32];
+    const auto res =
+        ShortestDoubleRepresentation()
+            ? std::to_chars(buf, buf + sizeof(buf), value)
+            : std::to_chars(buf, buf + sizeof(buf), value,
+                  std::chars_format::general, 17);
+    const std::string_view str{buf, static_cast<std::size_t>(res.ptr - buf)};
+    buffer_ += str;
+    if (str.find_first_of(".eE") == std::string_view::npos) {
+      buffer_ += ".0";
+    }
+  }
+
+  /// @brief Writes the value at `fqn`. The key buffer `fqn` will be
+  ///   extended for nested parameters and restored before returning.
+  void WriteValue(const werkzeugkiste::config::Configuration &cfg,
+      std::string &fqn) {
+    switch (cfg.Type(fqn)) {
+      case werkzeugkiste::config::ConfigType::Boolean:
+        buffer_ += cfg.GetBool(fqn) ? "true" : "false";
+        break;
+
+      case werkzeugkiste::config::ConfigType::Integer:
+        WriteInteger(cfg.GetInt64(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::FloatingPoint:
+        WriteDouble(cfg.GetDouble(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::String:
+        WriteString(cfg.GetString(fqn));
+        break;
+
+      case werkzeugkiste::config::ConfigType::Date:
+        WriteReference([&](werkzeugkiste::config::Configuration &single,
+                           std::string_view key) {
+          single.SetDate(key, cfg.GetDate(fqn));
+        });
+        break;
+
+      case werkzeugkiste::config::ConfigType::Time:
+        WriteReference([&](werkzeugkiste::config::Configuration &single,
+                           std::string_view key) {
+          single.SetTime(key, cfg.GetTime(fqn));
+        });
+        break;
+
+      case werkzeugkiste::config::ConfigType::DateTime:
+        WriteReference([&](werkzeugkiste::config::Configuration &single,
+                           std::string_view key) {
+          single.SetDateTime(key, cfg.GetDateTime(fqn));
+        });
+        break;
+
+      case werkzeugkiste::config::ConfigType::List:
+        WriteList(cfg, fqn);
+        break;
+
+      case werkzeugkiste::config::ConfigType::Group:
+        WriteGroup(cfg, fqn);
+        break;
+    }
+  }
+
+  void WriteList(const werkzeugkiste::config::Configuration &cfg,
+      std::string &fqn) {
+    const std::size_t prefix_len = fqn.length();
+    const std::size_t num_el = cfg.Size(fqn);
+    if (num_el == 0) {
+      buffer_ += "[]";
+      return;
+    }
+
+    buffer_ += '[';
+    ++depth_;
+    for (std::size_t idx = 0; idx < num_el; ++idx) {
+      if (idx > 0) {
+        buffer_ += ',';
+      }
+      NewLine();
+      fqn += '[';
+      fqn += std::to_string(idx);
+      fqn += ']';
+      WriteValue(cfg, fqn);
+      fqn.resize(prefix_len);
+    }
+    --depth_;
+    NewLine();
+    buffer_ += ']';
+  }
+
+  void WriteGroup(const werkzeugkiste::config::Configuration &cfg,
+      std::string &fqn) {
+    const std::size_t prefix_len = fqn.length();
+    const std::vector<std::string> keys = cfg.ListParameterNames(
+        fqn, /*include_array_entries=*/false, /*recursive=*/false);
+    if (keys.empty()) {
+      buffer_ += "{}";
+      return;
+    }
+
+    buffer_ += '{';
+    ++depth_;
+    bool first = true;
+    for (const std::string &key : keys) {
+      if (!first) {
+        buffer_ += ',';
+      }
+      first = false;
+      NewLine();
+      WriteString(key);
+      buffer_ += " : ";
+      if (prefix_len > 0) {
+        fqn += '.';
+      }
+      fqn += key;
+      WriteValue(cfg, fqn);
+      fqn.resize(prefix_len);
+    }
+    --depth_;
+    NewLine();
+    buffer_ += '}';
+  }
+};
+}  // namespace json
+
+/// @brief Serializes the group at `fqn` as JSON.
+inline std::string SerializeJSONGroup(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string_view fqn) {
+  json::Writer writer{};
+  writer.WriteRootGroup(cfg, fqn);
+  return writer.Finish();
+}
+
+/// @brief Serializes the list at `fqn` as parameter `wrapper_key` of an
+///   otherwise empty JSON object.
+inline std::string SerializeJSONList(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string_view fqn,
+    std::string_view wrapper_key) {
+  json::Writer writer{};
+  writer.WriteRootList(cfg, fqn, wrapper_key);
+  return writer.Finish();
+}
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_JSON_H
@@ -0,0 +1,260 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_LAZY_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_LAZY_H
+
+#include <werkzeugkiste-bindings/detail/config_bindings_io.h>
+#include <werkzeugkiste/config/configuration.h>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief A JSON document of which only the top-level structure has been
+///   indexed.
+///
+/// Loading only scans the document for the byte ranges of the top-level
+/// values, *i.e.* without building any configuration parameters. A value
+/// is parsed the first time it is requested via `Take`. The file contents
+/// are memory-mapped (if supported), thus untouched parts of the document
+/// are not even read from disk.
+class LazyJSONDocument {
+ public:
+  /// @brief Indexes the top-level parameters of the JSON document.
+  ///
+  /// Throws a `ParseError` if the top-level structure is invalid. Syntax
+  /// errors within a value will only be reported once it is accessed.
+  static std::unique_ptr<LazyJSONDocument> Index(std::string filename,
+      FileBuffer &&buffer,
+      werkzeugkiste::config::NullValuePolicy none_policy) {
+    std::unique_ptr<LazyJSONDocument> doc{new LazyJSONDocument(
+        std::move(filename), std::move(buffer), none_policy)};
+    doc->BuildIndex();
+    return doc;
+  }
+
+  /// @brief Returns true if the top-level parameter has not been parsed yet.
+  bool IsPending(std::string_view key) const {
+    return pending_.find(std::string{key}) != pending_.end();
+  }
+
+  /// @brief Returns true if all top-level parameters have been parsed.
+  bool Empty() const { return pending_.empty(); }
+
+  /// @brief Parses the (pending) top-level parameter `key`.
+  ///
+  /// Returns a configuration which holds only this parameter, or `nullopt`
+  /// if there is no such pending parameter. Note that the returned
+  /// configuration will be empty for `null` values if the null value policy
+  /// is set to skip them.
+  std::optional<werkzeugkiste::config::Configuration> Take(
+      std::string_view key) {
+    const auto it = pending_.find(std::string{key});
+    if (it == pending_.end()) {
+      return std::nullopt;
+    }
+
+    // Parse a document which only holds the requested parameter.
+    std::string json{"{\""};
+    json += it->first;
+    json += "\":";
+    json += buffer_.View().substr(it->second.offset, it->second.length);
+    json += '}';
+    const auto none_policy = none_policy_;
+    werkzeugkiste::config::Configuration cfg = ParseFileBuffer(
+        filename_, buffer_, [&json, none_policy](std::string_view) {
+          return werkzeugkiste::config::LoadJSONString(json, none_policy);
+        });
+    pending_.erase(it);
+    return cfg;
+  }
+
+  /// @brief Parses all pending top-level parameters.
+  ///
+  /// Returns a configuration which holds only the pending parameters, *i.e.*
+  /// parameters which have already been parsed via `Take` will not be parsed
+  /// again.
+  werkzeugkiste::config::Configuration TakePending() {
+    std::string json{"{"};
+    for (const auto &[key, range] : pending_) {
+      if (json.length() > 1) {
+        json += ',';
+      }
+      json += '"';
+      json += key;
+      json += "\":";
+      json += buffer_.View().substr(range.offset, range.length);
+    }
+    json += '}';
+    const auto none_policy = none_policy_;
+    werkzeugkiste::config::Configuration cfg = ParseFileBuffer(
+        filename_, buffer_, [&json, none_policy](std::string_view) {
+          return werkzeugkiste::config::LoadJSONString(json, none_policy);
+        });
+    pending_.clear();
+    return cfg;
+  }
+
+ private:
+  struct ValueRange {
+    std::size_t offset{0};
+    std::size_t length{0};
+  };
+
+  std::string filename_{};
+  FileBuffer buffer_{};
+  werkzeugkiste::config::NullValuePolicy none_policy_{};
+  std::unordered_map<std::string, ValueRange> pending_{};
+
+  LazyJSONDocument(std::string filename,
+      FileBuffer &&buffer,
+      werkzeugkiste::config::NullValuePolicy none_policy)
+      : filename_{std::move(filename)},
+        buffer_{std::move(buffer)},
+        none_policy_{none_policy} {}
+
+  static bool IsWhitespace(char c) {
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+  }
+
+  [[noreturn]] void ThrowStructureError(std::size_t pos,
+      std::string_view reason) const {
+    std::string msg{"Error while parsing `"};
+    msg += filename_;
+    msg += "`: Invalid JSON structure at byte ";
+    msg += std::to_string(pos);
+    msg += ", ";
+    msg += reason;
+    msg += '!';
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+
+  std::size_t SkipWhitespace(std::string_view json, std::size_t pos) const {
+    while ((pos < json.length()) && IsWhitespace(json[pos])) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  /// @brief Returns the position after the closing quote of the string
+  ///   starting at `pos`.
+  std::size_t SkipString(std::string_view json, std::size_t pos) const {
+    const std::size_t start = pos;
+    ++pos;
+    while (pos < json.length()) {
+      if (json[pos] == '\\') {
+        pos += 2;
+      } else if (json[pos] == '"') {
+        return pos + 1;
+      } else {
+        ++pos;
+      }
+    }
+    ThrowStructureError(start, "unterminated string");
+  }
+
+  /// @brief Returns the end of the value starting at `pos`, *i.e.* the
+  ///   position of the delimiting `,` or `}` of the top-level object.
+  std::size_t SkipValue(std::string_view json, std::size_t pos) const {
+    std::size_t depth = 0;
+    while (pos < json.length()) {
+      const char c = json[pos];
+      if (c == '"') {
+        pos = SkipString(json, pos);
+        continue;
+      }
+      if ((c == '{') || (c == '[')) {
+        ++depth;
+      } else if ((c == '}') || (c == ']')) {
+        if (depth == 0) {
+          return pos;
+        }
+        --depth;
+      } else if ((c == ',') && (depth == 0)) {
+        return pos;
+      }
+      ++pos;
+    }
+    return pos;
+  }
+
+  void BuildIndex() {
+    const std::string_view json = buffer_.View();
+    std::size_t pos = 0;
+    // Skip the UTF-8 byte order mark
+    if ((json.length() >= 3) && (json.substr(0, 3) == "\xEF\xBB\xBF")) {
+      pos = 3;
+    }
+
+    pos = SkipWhitespace(json, pos);
+    if ((pos >= json.length()) || (json[pos] != '{')) {
+      ThrowStructureError(pos, "expected a top-level object");
+    }
+    pos = SkipWhitespace(json, pos + 1);
+
+    bool expect_key = false;
+    while ((pos < json.length()) && (expect_key || (json[pos] != '}'))) {
+      if (json[pos] != '"') {
+        ThrowStructureError(pos, "expected a parameter name");
+      }
+      const std::size_t key_end = SkipString(json, pos);
+      std::string key{json.substr(pos + 1, key_end - pos - 2)};
+      if (!werkzeugkiste::config::IsValidKey(key, /*allow_dots=*/false)) {
+        std::string reason{"parameter name `"};
+        reason += key;
+        reason +=
+            "` is invalid. Only alpha-numeric characters, hyphen and "
+            "underscore are allowed";
+        ThrowStructureError(pos, reason);
+      }
+
+      pos = SkipWhitespace(json, key_end);
+      if ((pos >= json.length()) || (json[pos] != ':')) {
+        ThrowStructureError(pos, "expected `:`");
+      }
+      const std::size_t value_begin = SkipWhitespace(json, pos + 1);
+      const std::size_t value_end = SkipValue(json, value_begin);
+      std::size_t value_last = value_end;
+      while ((value_last > value_begin) && IsWhitespace(json[value_last - 1])) {
+        --value_last;
+      }
+      if (value_last == value_begin) {
+        ThrowStructureError(value_begin, "expected a value");
+      }
+      if ((value_end >= json.length()) ||
+          ((json[value_end] != ',') && (json[value_end] != '}'))) {
+        ThrowStructureError(value_end, "expected `,` or `}`");
+      }
+
+      // As with the eager parser, the last definition of a duplicate
+      // parameter name takes precedence.
+      pending_.insert_or_assign(
+          std::move(key), ValueRange{value_begin, value_last - value_begin});
+
+      expect_key = (json[value_end] == ',');
+      pos = SkipWhitespace(json, value_end + 1);
+      if (!expect_key) {
+        // Consumed the closing brace of the top-level object
+        if (pos < json.length()) {
+          ThrowStructureError(pos, "unexpected trailing data");
+        }
+        return;
+      }
+    }
+
+    if (expect_key || (pos >= json.length())) {
+      ThrowStructureError(pos, "unexpected end of document");
+    }
+    // Empty top-level object
+    pos = SkipWhitespace(json, pos + 1);
+    if (pos < json.length()) {
+      ThrowStructureError(pos, "unexpected trailing data");
+    }
+  }
+};
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_LAZY_H
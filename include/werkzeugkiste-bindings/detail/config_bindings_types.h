@@ -11,78 +11,71 @@
 #include <werkzeugkiste/config/configuration.h>
 #include <werkzeugkiste/config/keymatcher.h>
 #include <werkzeugkiste/logging.h>
-
+#include <werkzeugkiste-bindings/detail/config_bindings_binary.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_diff.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_io.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_json.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_lazy.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_utils.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_watch.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_yaml.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace werkzeugkiste::bindings::detail {
-/// @brief Copies the list `fqn_src` from `src` to `fqn_dst` in `dst`.
-inline void CopyList(const werkzeugkiste::config::Configuration &src,
-    std::string_view fqn_src,
-    werkzeugkiste::config::Configuration &dst,
-    std::string_view fqn_dst) {
-  if (!dst.Contains(fqn_dst)) {
-    std::string msg{"CopyList requires that the list parameter `"};
-    msg += fqn_dst;
-    msg += "` already exists!";
-    throw std::logic_error{msg};
-  }
-
-  const std::size_t size_src = src.Size(fqn_src);
-  for (std::size_t idx = 0; idx < size_src; ++idx) {
-    const std::string fqn_src_elem =
-        werkzeugkiste::config::Configuration::KeyForListElement(
-          fqn_src, idx);
-    
-    switch (src.Type(fqn_src_elem)) {
-      case werkzeugkiste::config::ConfigType::Boolean:
-        dst.Append(fqn_dst, src.GetBool(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::Integer:
-        dst.Append(fqn_dst, src.GetInt64(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::FloatingPoint:
-        dst.Append(fqn_dst, src.GetDouble(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::String:
-        dst.Append(fqn_dst, src.GetString(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::List: {
-        // We need to append a list, then recurse with a
-        // properly adjusted key
-        const std::size_t size_dst = dst.Size(fqn_dst);
-        const std::string fqn_dst_elem =
-            werkzeugkiste::config::Configuration::KeyForListElement(
-              fqn_dst, size_dst);
-        dst.AppendList(fqn_dst);
-        CopyList(src, fqn_src_elem, dst, fqn_dst_elem);
-        break;
-      }
-
-      case werkzeugkiste::config::ConfigType::Group:
-        dst.Append(fqn_dst, src.GetGroup(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::Date:
-        dst.Append(fqn_dst, src.GetDate(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::Time:
-        dst.Append(fqn_dst, src.GetTime(fqn_src_elem));
-        break;
-
-      case werkzeugkiste::config::ConfigType::DateTime:
-        dst.Append(fqn_dst, src.GetDateTime(fqn_src_elem));
-        break;
-    }
+/// @brief Copies the parameter `fqn` from `src` to `dst`.
+inline void CopyParameter(const werkzeugkiste::config::Configuration &src,
+    std::string_view fqn,
+    werkzeugkiste::config::Configuration &dst) {
+  switch (src.Type(fqn)) {
+    case werkzeugkiste::config::ConfigType::Boolean:
+      dst.SetBool(fqn, src.GetBool(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::Integer:
+      dst.SetInt64(fqn, src.GetInt64(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::FloatingPoint:
+      dst.SetDouble(fqn, src.GetDouble(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::String:
+      dst.SetString(fqn, src.GetString(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::List:
+      dst.CreateList(fqn);
+      CopyList(src, fqn, dst, fqn);
+      break;
+
+    case werkzeugkiste::config::ConfigType::Group:
+      dst.SetGroup(fqn, src.GetGroup(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::Date:
+      dst.SetDate(fqn, src.GetDate(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::Time:
+      dst.SetTime(fqn, src.GetTime(fqn));
+      break;
+
+    case werkzeugkiste::config::ConfigType::DateTime:
+      dst.SetDateTime(fqn, src.GetDateTime(fqn));
+      break;
   }
 }
 
@@ -114,33 +107,241 @@ pybind11::array_t<Tp> MatToArray(const werkzeugkiste::config::Matrix<Tp> &mat){
       mat.data());
 }
 
+/// @brief Converts parameter `key` of `cfg` to the corresponding python
+///   type, *i.e.* lists and groups are converted recursively to `list` and
+///   `dict`. An empty key denotes the root group.
+///
+/// The parameter tree is converted in a single pass, which extends the key
+/// buffer for nested parameters (and restores it before returning) instead
+/// of building a new fully qualified name for each parameter.
+inline pybind11::object ParameterToPyObject(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string &key) {
+  using werkzeugkiste::config::ConfigType;
+  const ConfigType type = key.empty() ? ConfigType::Group : cfg.Type(key);
+  switch (type) {
+    case ConfigType::Boolean:
+      return pybind11::bool_{cfg.GetBool(key)};
+
+    case ConfigType::Integer:
+      return pybind11::int_{cfg.GetInt64(key)};
+
+    case ConfigType::FloatingPoint:
+      return pybind11::float_{cfg.GetDouble(key)};
+
+    case ConfigType::String:
+      return pybind11::str{cfg.GetString(key)};
+
+    case ConfigType::Date:
+      return DateToPyObj(cfg.GetDate(key));
+
+    case ConfigType::Time:
+      return TimeToPyObj(cfg.GetTime(key));
+
+    case ConfigType::DateTime:
+      return DateTimeToPyObj(cfg.GetDateTime(key));
+
+    case ConfigType::List: {
+      const std::size_t num_el = cfg.Size(key);
+      const std::size_t len = key.length();
+      pybind11::list lst{num_el};
+      for (std::size_t idx = 0; idx < num_el; ++idx) {
+        AppendListIndex(key, idx);
+        lst[idx] = ParameterToPyObject(cfg, key);
+        key.resize(len);
+      }
+      return std::move(lst);
+    }
+
+    case ConfigType::Group: {
+      const std::vector<std::string> names = cfg.ListParameterNames(
+          key, /*include_array_entries=*/false, /*recursive=*/false);
+      const std::size_t len = key.length();
+      pybind11::dict d{};
+      for (const std::string &name : names) {
+        AppendParameterName(key, name);
+        d[pybind11::str(name)] = ParameterToPyObject(cfg, key);
+        key.resize(len);
+      }
+      return std::move(d);
+    }
+  }
+
+  std::string msg{"Returning parameter `"};
+  msg += key;
+  msg += "` as `";
+  msg += werkzeugkiste::config::ConfigTypeToString(type);
+  msg += "` is not yet implemented!";
+  throw std::logic_error{msg};
+}
+
+/// @brief Kinds of python objects which can be converted to parameters.
+enum class PyValueKind : unsigned char {
+  String,
+  Boolean,
+  Integer,
+  FloatingPoint,
+  /// @brief A `list` or `tuple`.
+  Sequence,
+  Dict,
+  Config,
+  /// @brief A numpy array.
+  Array,
+  Date,
+  Time,
+  DateTime,
+  Unsupported
+};
+
+/// @brief Returns the kind of the python object.
+///
+/// Dispatches on the type pointer, *i.e.* the common built-in types and the
+/// `datetime` types can be classified without any attribute lookup. Only
+/// other types (*e.g.* subclasses) require the slower instance checks.
+PyValueKind ClassifyPyValue(pybind11::handle value);
+
 /// @brief Holds the actual configuration data (to enable shared memory usage
 ///   among the Config instances).
 struct DataHolder {
   werkzeugkiste::config::Configuration data{};
+
+  /// @brief A parsed configuration which is shared with the
+  ///   `ParsedFileCache`. If set, it is used instead of `data` until the
+  ///   first modification, which copies it into `data` (copy-on-write).
+  std::shared_ptr<const werkzeugkiste::config::Configuration> shared{};
+
+  /// @brief The configuration file, if the configuration has been loaded
+  ///   from a file. Required to watch the file for modifications.
+  std::optional<ConfigSource> source{};
+
+  /// @brief Configuration files which have been loaded via `LoadNested`.
+  std::vector<NestedSource> nested{};
+
+  /// @brief The not yet parsed top-level parameters of a lazily loaded
+  ///   configuration, see `Config::Materialize`.
+  std::unique_ptr<LazyJSONDocument> lazy{};
+
+  /// @brief Cached fingerprints of the groups/lists, see
+  ///   `Config::Fingerprint`.
+  FingerprintCache fingerprints{};
+
+  /// @brief Frozen configurations cannot be modified, but can be hashed.
+  bool frozen{false};
+
+  /// @brief Number of threads which currently read the configuration without
+  ///   holding the GIL, see `ReadOnlyScope`. Must only be accessed while
+  ///   holding the GIL.
+  std::size_t num_readers_without_gil{0};
+};
+
+/// @brief Rejects modifications of the shared configuration data (similar to
+///   a frozen configuration) while it is read without holding the GIL, *e.g.*
+///   by `Config::Dump`. Must be created and destroyed while holding the GIL.
+class ReadOnlyScope {
+ public:
+  explicit ReadOnlyScope(DataHolder &data) : data_{data} {
+    ++data_.num_readers_without_gil;
+  }
+
+  ~ReadOnlyScope() { --data_.num_readers_without_gil; }
+
+  ReadOnlyScope(const ReadOnlyScope &) = delete;
+  ReadOnlyScope &operator=(const ReadOnlyScope &) = delete;
+  ReadOnlyScope(ReadOnlyScope &&) = delete;
+  ReadOnlyScope &operator=(ReadOnlyScope &&) = delete;
+
+ private:
+  DataHolder &data_;
+};
+
+/// @brief Shares a copy of the python object `obj`, which may be released
+///   without holding the GIL, *e.g.* by the detached background thread of a
+///   `PyConfigWatcher`.
+template <typename Tp>
+std::shared_ptr<Tp> ShareWithGIL(const Tp &obj) {
+  return std::shared_ptr<Tp>{new Tp{obj}, [](Tp *ptr) {
+                               pybind11::gil_scoped_acquire acquire;
+                               delete ptr;
+                             }};
+}
+
+/// @brief Watcher which invokes python callbacks, see `Config::Watch`.
+///
+/// The background thread requires the GIL to invoke the callbacks. Thus,
+/// the GIL must be released while waiting for the thread to finish.
+class PyConfigWatcher : public ConfigWatcher {
+ public:
+  using ConfigWatcher::ConfigWatcher;
+
+  ~PyConfigWatcher() override {
+    if (PyGILState_Check() != 0) {
+      pybind11::gil_scoped_release release;
+      Stop();
+    } else {
+      Stop();
+    }
+  }
 };
 
 class Config {
  public:
   //---------------------------------------------------------------------------
   // Iterator
+
+  /// @brief What an `Iterator` yields.
+  enum class IteratorMode {
+    /// @brief Parameter names of a group or (copies of) the values of a list.
+    Default,
+    /// @brief Parameter names of a group.
+    Keys,
+    /// @brief Parameter values of a group.
+    Values,
+    /// @brief (name, value) pairs of a group.
+    Items
+  };
+
+  /// @brief Iterates over the parameter names of a group or the values of
+  ///   a list.
+  ///
+  /// Iterators are compared by identity of the configuration and index.
+  /// Thus, advancing and comparing is O(1). Only the begin iterator of a
+  /// group takes a snapshot of its parameter names (as werkzeugkiste does
+  /// not provide positional access to named parameters), whereas the
+  /// parameters are addressed via a reused key buffer.
+  ///
+  /// Values of a group are only looked up when they are yielded and nested
+  /// lists/groups are returned as views.
   struct Iterator {
-    Iterator(Config const *cfg,
-        werkzeugkiste::config::ConfigType type,
-        std::size_t idx)
-        : cfg_{cfg},
-          is_group_{type == werkzeugkiste::config::ConfigType::Group},
-          idx_{idx} {
-      if (is_group_) {
-        keys_ = cfg->Keys();
+    Iterator(Config const *cfg, std::size_t idx) : cfg_{cfg}, idx_{idx} {}
+
+    static Iterator Begin(Config const *cfg,
+        IteratorMode mode = IteratorMode::Default) {
+      Iterator it{cfg, 0};
+      it.mode_ = mode;
+      it.is_group_ = (cfg->Type() == werkzeugkiste::config::ConfigType::Group);
+      // Raises a TypeError for lists unless the default mode is requested.
+      if (it.is_group_ || (mode != IteratorMode::Default)) {
+        it.keys_ = cfg->Keys();
       }
+      it.key_ = cfg->fqn_prefix_;
+      return it;
     }
 
     pybind11::object operator*() {
-      if (is_group_) {
+      key_.resize(cfg_->fqn_prefix_.length());
+      if (!is_group_) {
+        AppendListIndex(key_, idx_);
+        return cfg_->GetBuiltinValue(key_);
+      }
+
+      if ((mode_ == IteratorMode::Default) || (mode_ == IteratorMode::Keys)) {
         return pybind11::str(keys_[idx_]);
       }
-      return cfg_->GetValue(idx_);
+      AppendParameterName(key_, keys_[idx_]);
+      if (mode_ == IteratorMode::Values) {
+        return cfg_->GetBuiltinOrView(key_);
+      }
+      return pybind11::make_tuple(keys_[idx_], cfg_->GetBuiltinOrView(key_));
     }
 
     // Prefix increment
@@ -157,10 +358,7 @@ class Config {
     }
 
     friend bool operator==(const Iterator &a, const Iterator &b) {
-      if (a.idx_ != b.idx_) {
-        return false;
-      }
-      return a.cfg_->Equals(*b.cfg_);
+      return (a.cfg_ == b.cfg_) && (a.idx_ == b.idx_);
     }
 
     friend bool operator!=(const Iterator &a, const Iterator &b) {
@@ -169,45 +367,115 @@ class Config {
 
    private:
     Config const *cfg_{nullptr};
+    IteratorMode mode_{IteratorMode::Default};
     bool is_group_{false};
     std::size_t idx_{0};
     std::vector<std::string> keys_{};
+    std::string key_{};
   };
 
-  Iterator cbegin() const { return Iterator(this, Type(), 0); }
-  Iterator cend() const { return Iterator(this, Type(), Length()); }
+  Iterator cbegin(IteratorMode mode = IteratorMode::Default) const {
+    return Iterator::Begin(this, mode);
+  }
+  Iterator cend() const { return Iterator(this, Length()); }
 
   //---------------------------------------------------------------------------
   // Construction / Loading
 
-  static Config LoadFile(pybind11::handle filename) {
+  // All loading functions convert their python arguments first and then
+  // release the GIL while werkzeugkiste parses the configuration. This allows
+  // multiple python threads to load configurations concurrently.
+
+  static Config LoadFile(pybind11::handle filename, bool cached) {
+    const std::string fname = PyObjToString(filename);
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data = werkzeugkiste::config::LoadFile(PyObjToString(filename));
+    {
+      pybind11::gil_scoped_release release;
+      if (cached) {
+        // The cached configuration is shared until the first modification,
+        // see `MutableConfig`.
+        cfg.data_->shared = ParsedFileCache::Instance().Load(
+            fname, LoadConfigFileByExtension);
+      } else {
+        cfg.data_->data = LoadConfigFileByExtension(fname);
+      }
+      cfg.SetSource(fname, LoadConfigFileByExtension);
+    }
     return cfg;
   }
 
-  static Config LoadTOMLFile(pybind11::handle filename) {
+  static Config LoadTOMLFile(pybind11::handle filename, bool use_mmap) {
+    const std::string fname = PyObjToString(filename);
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data =
-        werkzeugkiste::config::LoadTOMLFile(PyObjToString(filename));
+    {
+      pybind11::gil_scoped_release release;
+      const auto load = [](const std::string &f, bool mmap) {
+        return LoadConfigFile(
+            f,
+            mmap,
+            [](const std::string &toml_file) {
+              return werkzeugkiste::config::LoadTOMLFile(toml_file);
+            },
+            [](std::string_view toml_str) {
+              return werkzeugkiste::config::LoadTOMLString(toml_str);
+            });
+      };
+      cfg.data_->data = load(fname, use_mmap);
+      cfg.SetSource(
+          fname, [load](const std::string &f) { return load(f, false); });
+    }
     return cfg;
   }
 
   static Config LoadTOMLString(std::string_view toml_str) {
+    // The string_view refers to the buffer of the python `str` argument,
+    // which is kept alive by the caller for the duration of this call.
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data = werkzeugkiste::config::LoadTOMLString(toml_str);
+    {
+      pybind11::gil_scoped_release release;
+      cfg.data_->data = werkzeugkiste::config::LoadTOMLString(toml_str);
+    }
     return cfg;
   }
 
   static Config LoadJSONFile(pybind11::handle filename,
-      werkzeugkiste::config::NullValuePolicy none_policy) {
+      werkzeugkiste::config::NullValuePolicy none_policy,
+      bool use_mmap,
+      bool lazy) {
+    const std::string fname = PyObjToString(filename);
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data = werkzeugkiste::config::LoadJSONFile(
-        PyObjToString(filename), none_policy);
+    {
+      pybind11::gil_scoped_release release;
+      const auto load = [none_policy](const std::string &f, bool mmap) {
+        return LoadConfigFile(
+            f,
+            mmap,
+            [none_policy](const std::string &json_file) {
+              return werkzeugkiste::config::LoadJSONFile(
+                  json_file, none_policy);
+            },
+            [none_policy](std::string_view json_str) {
+              return werkzeugkiste::config::LoadJSONString(
+                  json_str, none_policy);
+            });
+      };
+      if (lazy) {
+        // Only the top-level structure is indexed now. The parameters will
+        // be parsed upon their first access, see `Materialize`.
+        cfg.data_->lazy = LazyJSONDocument::Index(fname,
+            FileBuffer::IsGzipCompressed(fname) ? FileBuffer::Inflate(fname)
+                                                : FileBuffer::Map(fname),
+            none_policy);
+      } else {
+        cfg.data_->data = load(fname, use_mmap);
+      }
+      cfg.SetSource(
+          fname, [load](const std::string &f) { return load(f, false); });
+    }
     return cfg;
   }
 
@@ -215,23 +483,163 @@ class Config {
       werkzeugkiste::config::NullValuePolicy none_policy) {
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data =
-        werkzeugkiste::config::LoadJSONString(json_str, none_policy);
+    {
+      pybind11::gil_scoped_release release;
+      cfg.data_->data =
+          werkzeugkiste::config::LoadJSONString(json_str, none_policy);
+    }
     return cfg;
   }
 
   static Config LoadLibconfigFile(pybind11::handle filename) {
+    const std::string fname = PyObjToString(filename);
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data =
-        werkzeugkiste::config::LoadLibconfigFile(PyObjToString(filename));
+    {
+      pybind11::gil_scoped_release release;
+      const auto load = [](const std::string &f) {
+        return LoadConfigFile(
+            f,
+            /*use_mmap=*/false,
+            [](const std::string &lcfg_file) {
+              return werkzeugkiste::config::LoadLibconfigFile(lcfg_file);
+            },
+            [](std::string_view lcfg_str) {
+              return werkzeugkiste::config::LoadLibconfigString(lcfg_str);
+            });
+      };
+      cfg.data_->data = load(fname);
+      cfg.SetSource(fname, load);
+    }
     return cfg;
   }
 
   static Config LoadLibconfigString(std::string_view lcfg_str) {
     Config cfg{};
     cfg.data_ = std::make_shared<DataHolder>();
-    cfg.data_->data = werkzeugkiste::config::LoadLibconfigString(lcfg_str);
+    {
+      pybind11::gil_scoped_release release;
+      cfg.data_->data = werkzeugkiste::config::LoadLibconfigString(lcfg_str);
+    }
+    return cfg;
+  }
+
+  static Config LoadYAMLFile(pybind11::handle filename,
+      werkzeugkiste::config::NullValuePolicy none_policy,
+      bool use_mmap) {
+    const std::string fname = PyObjToString(filename);
+    Config cfg{};
+    cfg.data_ = std::make_shared<DataHolder>();
+    {
+      pybind11::gil_scoped_release release;
+      cfg.data_->data = detail::LoadYAMLFile(fname, none_policy, use_mmap);
+      cfg.SetSource(fname, [none_policy](const std::string &f) {
+        return detail::LoadYAMLFile(f, none_policy, /*use_mmap=*/false);
+      });
+    }
+    return cfg;
+  }
+
+  static Config LoadYAMLString(std::string_view yaml_str,
+      werkzeugkiste::config::NullValuePolicy none_policy) {
+    Config cfg{};
+    cfg.data_ = std::make_shared<DataHolder>();
+    {
+      pybind11::gil_scoped_release release;
+      cfg.data_->data = detail::LoadYAMLString(yaml_str, none_policy);
+    }
+    return cfg;
+  }
+
+  /// @brief Loads a configuration from its binary encoding, see `ToBinary`.
+  ///
+  /// If `data` supports the buffer protocol (`bytes`, `bytearray`,
+  /// `memoryview`, ...), it will be decoded in-place. Otherwise, `data` is
+  /// interpreted as the path to a binary configuration file.
+  static Config LoadBinary(pybind11::handle data) {
+    Config cfg{};
+    if (PyObject_CheckBuffer(data.ptr())) {
+      Py_buffer view{};
+      if (PyObject_GetBuffer(data.ptr(), &view, PyBUF_SIMPLE) != 0) {
+        throw pybind11::error_already_set();
+      }
+      try {
+        pybind11::gil_scoped_release release;
+        cfg.data_->data = DecodeBinary(std::string_view{
+            static_cast<const char *>(view.buf),
+            static_cast<std::size_t>(view.len)});
+      } catch (...) {
+        PyBuffer_Release(&view);
+        throw;
+      }
+      PyBuffer_Release(&view);
+    } else {
+      const std::string fname = PyObjToString(data);
+      pybind11::gil_scoped_release release;
+      const FileBuffer buffer = FileBuffer::Map(fname);
+      cfg.data_->data = ParseFileBuffer(fname, buffer, DecodeBinary);
+    }
+    return cfg;
+  }
+
+  /// @brief Loads multiple configuration files concurrently.
+  ///
+  /// The configuration type of each file is deduced from its extension, as
+  /// in `LoadFile`. Parsing errors are collected for all files and reported
+  /// via a single `ParseError` after all files have been processed.
+  static std::vector<Config> LoadMany(const pybind11::iterable &filenames,
+      std::size_t num_threads) {
+    std::vector<std::string> fnames{};
+    for (pybind11::handle filename : filenames) {
+      fnames.emplace_back(PyObjToString(filename));
+    }
+
+    std::vector<werkzeugkiste::config::Configuration> loaded(fnames.size());
+    std::vector<std::optional<std::string>> errors(fnames.size());
+    {
+      pybind11::gil_scoped_release release;
+      ParallelFor(fnames.size(), num_threads, [&](std::size_t idx) {
+        try {
+          loaded[idx] = LoadConfigFileByExtension(fnames[idx]);
+        } catch (const werkzeugkiste::config::ParseError &e) {
+          errors[idx] = e.what();
+        }
+      });
+    }
+
+    const auto num_failed = std::count_if(errors.begin(),
+        errors.end(),
+        [](const std::optional<std::string> &err) { return err.has_value(); });
+    if (num_failed > 0) {
+      std::string msg{"Failed to load "};
+      msg += std::to_string(num_failed);
+      msg += " of ";
+      msg += std::to_string(fnames.size());
+      msg += " configuration files:";
+      for (std::size_t idx = 0; idx < fnames.size(); ++idx) {
+        if (errors[idx].has_value()) {
+          msg += "\n  `";
+          msg += fnames[idx];
+          msg += "`: ";
+          msg += errors[idx].value();
+        }
+      }
+      throw werkzeugkiste::config::ParseError{msg};
+    }
+
+    std::vector<Config> cfgs{};
+    cfgs.reserve(loaded.size());
+    for (std::size_t idx = 0; idx < loaded.size(); ++idx) {
+      cfgs.emplace_back(FromConfiguration(std::move(loaded[idx])));
+      cfgs.back().SetSource(fnames[idx], LoadConfigFileByExtension);
+    }
+    return cfgs;
+  }
+
+  /// @brief Wraps an already loaded configuration.
+  static Config FromConfiguration(werkzeugkiste::config::Configuration &&data) {
+    Config cfg{};
+    cfg.data_->data = std::move(data);
     return cfg;
   }
 
@@ -263,23 +671,166 @@ class Config {
   //---------------------------------------------------------------------------
   // Serialization
 
-  std::string ToTOMLString() const { return CopyViewedGroup().ToTOML(); }
+  std::string ToTOMLString() const { return SerializeViewed("toml"); }
 
-  std::string ToJSONString() const { return CopyViewedGroup().ToJSON(); }
+  std::string ToJSONString() const { return SerializeViewed("json"); }
 
-  std::string ToYAMLString() const { return CopyViewedGroup().ToYAML(); }
+  std::string ToYAMLString() const { return SerializeViewed("yaml"); }
 
-  std::string ToLibconfigString() const {
-    return CopyViewedGroup().ToLibconfig();
-  }
+  std::string ToLibconfigString() const { return SerializeViewed("libconfig"); }
 
   pybind11::dict ToDict() const { return GetPyDict(fqn_prefix_); }
 
+  /// @brief Returns the binary encoding of the viewed group/list.
+  ///
+  /// As for the text formats, a list view is encoded as a group holding the
+  /// single parameter "list". In contrast to `CopyViewedGroup`, the encoder
+  /// reads the parameters directly from the underlying configuration.
+  pybind11::bytes ToBinary() const {
+    using namespace std::string_view_literals;
+    const werkzeugkiste::config::Configuration &cfg =
+        ImmutableConfig(fqn_prefix_);
+    const std::string encoded =
+        (!fqn_prefix_.empty() &&
+            (cfg.Type(fqn_prefix_) == werkzeugkiste::config::ConfigType::List))
+            ? EncodeBinaryList(cfg, fqn_prefix_, "list"sv)
+            : EncodeBinaryGroup(cfg, fqn_prefix_);
+    return pybind11::bytes{encoded};
+  }
+
+  /// @brief Serializes the viewed group/list and writes it to a file or a
+  ///   python file object, see `dump` in `config_bindings_access.h`.
+  ///
+  /// werkzeugkiste can only serialize into a string, thus the full output
+  /// is serialized into a native buffer first, *i.e.* the peak memory usage
+  /// is the size of the configuration plus the size of the output. This
+  /// buffer is then written chunk by chunk, *i.e.* without creating a python
+  /// `str` (or further copies) of the full output.
+  void Dump(pybind11::handle target,
+      const std::optional<std::string> &format) const {
+    const bool is_path = pybind11::isinstance<pybind11::str>(target) ||
+                         pybind11::hasattr(target, "__fspath__");
+    std::string fname{};
+    if (is_path) {
+      fname = PyObjToString(
+          pybind11::module::import("os").attr("fspath")(target));
+    } else if (!pybind11::hasattr(target, "write")) {
+      std::string msg{
+          "Dump requires a path or a file object, but got an object of type "
+          "`"};
+      msg += pybind11::cast<std::string>(
+          target.attr("__class__").attr("__name__"));
+      msg += "`!";
+      throw werkzeugkiste::config::TypeError{msg};
+    }
+
+    std::string fmt{};
+    if (format.has_value()) {
+      fmt = format.value();
+    } else if (is_path) {
+      fmt = DumpFormatFromExtension(fname);
+    } else {
+      throw werkzeugkiste::config::ValueError{
+          "The output `format` must be specified when dumping to a file "
+          "object!"};
+    }
+
+    const std::string serialized =
+        SerializeViewed(fmt, /*release_gil=*/true);
+
+    if (is_path) {
+      const bool compress =
+          std::filesystem::path{fname}.extension().string() == ".gz";
+      int error = 0;
+      {
+        pybind11::gil_scoped_release release;
+        error = WriteFileChunked(fname, serialized, compress);
+      }
+      if (error != 0) {
+        errno = error;
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, fname.c_str());
+        throw pybind11::error_already_set();
+      }
+      return;
+    }
+
+    // Python file objects are written chunk by chunk, thus only a single
+    // chunk has to be copied into a python object at a time.
+    const bool is_text = pybind11::isinstance(target,
+        pybind11::module::import("io").attr("TextIOBase"));
+    const pybind11::object write = target.attr("write");
+    const std::string_view contents{serialized};
+    std::size_t offset = 0;
+    while (offset < contents.length()) {
+      std::size_t len = std::min(kWriteChunkSize, contents.length() - offset);
+      if (is_text) {
+        // Don't split a multi-byte UTF-8 sequence, i.e. move the chunk end
+        // before any continuation bytes.
+        while ((offset + len < contents.length()) && (len > 0) &&
+               ((static_cast<unsigned char>(contents[offset + len]) & 0xC0U) ==
+                   0x80U)) {
+          --len;
+        }
+        write(pybind11::str{contents.data() + offset, len});
+      } else {
+        write(pybind11::bytes{contents.data() + offset, len});
+      }
+      offset += len;
+    }
+  }
+
+  /// @brief Returns the pickle state, *i.e.* the binary encoding. Similar to
+  ///   `Copy`, only views on (sub-)groups can be pickled.
+  pybind11::bytes PickleState() const {
+    if (Type() != werkzeugkiste::config::ConfigType::Group) {
+      std::string msg{"Cannot pickle a configuration view on a `"};
+      msg += werkzeugkiste::config::ConfigTypeToString(Type());
+      msg += "`. Only (sub-)groups can be pickled!";
+      throw werkzeugkiste::config::TypeError{msg};
+    }
+    return ToBinary();
+  }
+
   //---------------------------------------------------------------------------
   // Operators/Utils/Basics
 
   bool Equals(const Config &other) const {
-    return CopyViewedGroup().Equals(other.CopyViewedGroup());
+    // Differing (cached) fingerprints imply differing parameters.
+    const std::optional<std::uint64_t> fp = CachedFingerprint();
+    if (fp.has_value()) {
+      const std::optional<std::uint64_t> other_fp = other.CachedFingerprint();
+      if (other_fp.has_value() && (fp.value() != other_fp.value())) {
+        return false;
+      }
+    }
+    std::string key{other.fqn_prefix_};
+    return EqualsParameter(other.ImmutableConfig(other.fqn_prefix_), key);
+  }
+
+  /// @brief Returns the content hash of the viewed group/list.
+  ///
+  /// The fingerprints of all groups/lists are cached and only invalidated
+  /// along the path of a modified parameter. Thus, recomputing the
+  /// fingerprint after a modification only visits the modified subtree and
+  /// its ancestors.
+  std::uint64_t Fingerprint() const {
+    std::string key{fqn_prefix_};
+    return ParameterFingerprint(
+        ImmutableConfig(fqn_prefix_), key, data_->fingerprints);
+  }
+
+  void Freeze() { data_->frozen = true; }
+
+  bool IsFrozen() const { return data_->frozen; }
+
+  /// @brief Enables `__hash__`, which is only supported for frozen
+  ///   configurations.
+  std::size_t Hash() const {
+    if (!data_->frozen) {
+      throw werkzeugkiste::config::TypeError{
+          "Cannot hash a mutable configuration, use `freeze()` first!"};
+    }
+    return static_cast<std::size_t>(Fingerprint());
   }
 
   bool Equals(pybind11::handle other) const {
@@ -288,8 +839,8 @@ class Config {
     }
 
     if (pybind11::isinstance<pybind11::dict>(other)) {
-      return CopyViewedGroup().Equals(
-          PyDictToConfiguration(other.cast<pybind11::dict>()));
+      std::string key{fqn_prefix_};
+      return PyObjEqualsParameter(ImmutableConfig(fqn_prefix_), key, other);
     }
 
     std::string msg{"Cannot compare a `Config` instance against a `"};
@@ -299,6 +850,72 @@ class Config {
     throw werkzeugkiste::config::TypeError{msg};
   }
 
+  /// @brief Returns true if the viewed group/list equals the parameter `key`
+  ///   of `cfg`, which is compared in place. The key buffer will be restored
+  ///   before returning.
+  bool EqualsParameter(const werkzeugkiste::config::Configuration &cfg,
+      std::string &key) const {
+    std::string own_key{fqn_prefix_};
+    return ParametersEqual(ImmutableConfig(fqn_prefix_), own_key, cfg, key);
+  }
+
+  /// @brief Returns the added, removed and changed parameters (along with
+  ///   their values) of `other` w.r.t. this configuration.
+  ///
+  /// The parameter trees are compared natively, *i.e.* only the values of
+  /// differing parameters will be converted to python objects.
+  pybind11::dict Diff(const Config &other) const {
+    const ParameterDiff diff = ComputeParameterDiff(
+        ViewedGroup(), fqn_prefix_, other.ViewedGroup(), other.fqn_prefix_);
+
+    pybind11::dict added{};
+    for (const std::string &name : diff.added) {
+      added[pybind11::str(name)] = other.GetBuiltinValue(other.Key(name));
+    }
+
+    pybind11::dict removed{};
+    for (const std::string &name : diff.removed) {
+      removed[pybind11::str(name)] = GetBuiltinValue(Key(name));
+    }
+
+    pybind11::dict changed{};
+    for (const std::string &name : diff.changed) {
+      changed[pybind11::str(name)] = pybind11::make_tuple(
+          GetBuiltinValue(Key(name)), other.GetBuiltinValue(other.Key(name)));
+    }
+
+    pybind11::dict d{};
+    d["added"] = added;
+    d["removed"] = removed;
+    d["changed"] = changed;
+    return d;
+  }
+
+  /// @brief Applies a diff as returned by `Diff`.
+  ///
+  /// The patch is applied to a copy of the viewed group, which replaces the
+  /// viewed group only if all changes could be applied. Thus, a failing
+  /// patch leaves the configuration unchanged.
+  void ApplyPatch(const pybind11::dict &patch) {
+    if (Type() != werkzeugkiste::config::ConfigType::Group) {
+      std::string msg{"Patches can only be applied to (sub-)groups, but `"};
+      msg += fqn_prefix_;
+      msg += "` is a `";
+      msg += werkzeugkiste::config::ConfigTypeToString(Type());
+      msg += "`!";
+      throw werkzeugkiste::config::TypeError{msg};
+    }
+
+    Config patched{std::make_shared<DataHolder>(), std::string{}};
+    patched.data_->data = CopyViewedGroup();
+    patched.ApplyPatchUnchecked(patch);
+    if (fqn_prefix_.empty()) {
+      MutableConfig(fqn_prefix_) = std::move(patched.data_->data);
+    } else {
+      MutableConfig(fqn_prefix_).SetGroup(fqn_prefix_, patched.data_->data);
+    }
+  }
+
   bool Contains(std::string_view key) const {
     // If implemented for a sequence type (i.e. list), __contains__ should
     // check for equality of the values:
@@ -308,11 +925,13 @@ class Config {
       throw werkzeugkiste::config::TypeError{
           "`__contains__` is not supported for a Config view of a list!"};
     }
-    return ImmutableConfig().Contains(Key(key));
+    const std::string fqn = Key(key);
+    return ImmutableConfig(fqn).Contains(fqn);
   }
 
   std::size_t ParameterLength(std::string_view key) const {
-    return ImmutableConfig().Size(Key(key));
+    const std::string fqn = Key(key);
+    return ImmutableConfig(fqn).Size(fqn);
   }
 
   inline std::size_t Length() const {
@@ -322,10 +941,14 @@ class Config {
 
   bool Empty() const { return Length() == 0; }
 
-  void Delete(std::string_view key) { MutableConfig().Delete(Key(key)); }
+  void Delete(std::string_view key) {
+    const std::string fqn = Key(key);
+    MutableConfig(fqn).Delete(fqn);
+  }
 
   werkzeugkiste::config::ConfigType ParameterType(std::string_view key) const {
-    return ImmutableConfig().Type(Key(key));
+    const std::string fqn = Key(key);
+    return ImmutableConfig(fqn).Type(fqn);
   }
 
   inline werkzeugkiste::config::ConfigType Type() const {
@@ -339,7 +962,7 @@ class Config {
 
   void Clear() {
     if (Type() == werkzeugkiste::config::ConfigType::List) {
-      MutableConfig().ClearList(fqn_prefix_);
+      MutableConfig(fqn_prefix_).ClearList(fqn_prefix_);
     } else {
       for (const auto &key : Keys()) {
         Delete(key);
@@ -553,23 +1176,23 @@ class Config {
     const std::string fqn = Key(key);
 
     if (tp_name.compare("float64") == 0) {
-      return MatToArray(ImmutableConfig().GetMatrixDouble(fqn));
+      return MatToArray(ImmutableConfig(fqn).GetMatrixDouble(fqn));
     }
 
     if (tp_name.compare("float32") == 0) {
-      return MatToArray(ImmutableConfig().GetMatrixFloat(fqn));
+      return MatToArray(ImmutableConfig(fqn).GetMatrixFloat(fqn));
     }
     
     if (tp_name.compare("int64") == 0) {
-      return MatToArray(ImmutableConfig().GetMatrixInt64(fqn));
+      return MatToArray(ImmutableConfig(fqn).GetMatrixInt64(fqn));
     }
 
     if (tp_name.compare("int32") == 0) {
-      return MatToArray(ImmutableConfig().GetMatrixInt32(fqn));
+      return MatToArray(ImmutableConfig(fqn).GetMatrixInt32(fqn));
     }
 
     if (tp_name.compare("uint8") == 0) {
-      return MatToArray(ImmutableConfig().GetMatrixUInt8(fqn));
+      return MatToArray(ImmutableConfig(fqn).GetMatrixUInt8(fqn));
     }
 
     std::string msg{"Converting the configuration parameter `"};
@@ -617,12 +1240,13 @@ class Config {
   std::vector<std::string> ListParameterNames(bool include_array_entries,
       bool recursive,
       std::string_view key) const {
-    return ImmutableConfig().ListParameterNames(
-        Key(key), include_array_entries, recursive);
+    const std::string fqn = Key(key);
+    return ImmutableConfig(fqn).ListParameterNames(
+        fqn, include_array_entries, recursive);
   }
 
   std::vector<std::string> Keys() const {
-    return ImmutableConfig().ListParameterNames(
+    return ImmutableConfig(fqn_prefix_).ListParameterNames(
         fqn_prefix_, /*include_array_entries=*/false, /*recursive=*/false);
   }
 
@@ -630,30 +1254,211 @@ class Config {
       const std::vector<std::pair<std::string_view, std::string_view>>
           &replacements,
       std::string_view key) {
-    return MutableConfig().ReplaceStringPlaceholders(Key(key), replacements);
+    const std::string fqn = Key(key);
+    return MutableConfig(fqn).ReplaceStringPlaceholders(fqn, replacements);
   }
 
   void LoadNested(std::string_view key) {
-    MutableConfig().LoadNestedConfiguration(Key(key));
+    const std::string fqn = Key(key);
+    // Remember the nested file, so that it can be watched for modifications.
+    const std::string filename = ImmutableConfig(fqn).GetString(fqn);
+    MutableConfig(fqn).LoadNestedConfiguration(fqn);
+    data_->nested.push_back(NestedSource{fqn, AbsoluteFilename(filename)});
+  }
+
+  /// @brief Loads the nested configurations of all string parameters which
+  ///   match any of the given names/patterns.
+  ///
+  /// Each referenced file is parsed only once, even if it is referenced by
+  /// multiple parameters. The unique files are parsed concurrently (without
+  /// holding the GIL) and parsing errors are reported for all files via a
+  /// single `ParseError`, as in `LoadMany`.
+  ///
+  /// @return The number of replaced parameters.
+  std::size_t LoadAllNested(const std::vector<std::string_view> &patterns,
+      std::size_t num_threads) {
+    const werkzeugkiste::config::KeyMatcher matcher{patterns};
+    const werkzeugkiste::config::Configuration &cfg =
+        ImmutableConfig(fqn_prefix_);
+
+    // Collect the matching parameters and their unique nested files.
+    std::vector<NestedSource> references{};
+    std::vector<std::string> fnames{};
+    std::unordered_map<std::string, std::size_t> file_indices{};
+    const std::vector<std::string> names = cfg.ListParameterNames(
+        fqn_prefix_, /*include_array_entries=*/true, /*recursive=*/true);
+    for (const std::string &name : names) {
+      const std::string fqn = Key(name);
+      if (!matcher.Match(name) ||
+          (cfg.Type(fqn) != werkzeugkiste::config::ConfigType::String)) {
+        continue;
+      }
+      std::string filename = AbsoluteFilename(cfg.GetString(fqn));
+      if (file_indices.find(filename) == file_indices.end()) {
+        file_indices.emplace(filename, fnames.size());
+        fnames.push_back(filename);
+      }
+      references.push_back(NestedSource{fqn, std::move(filename)});
+    }
+
+    std::vector<werkzeugkiste::config::Configuration> loaded(fnames.size());
+    std::vector<std::optional<std::string>> errors(fnames.size());
+    {
+      pybind11::gil_scoped_release release;
+      ParallelFor(fnames.size(), num_threads, [&](std::size_t idx) {
+        try {
+          loaded[idx] = LoadConfigFileByExtension(fnames[idx]);
+        } catch (const werkzeugkiste::config::ParseError &e) {
+          errors[idx] = e.what();
+        }
+      });
+    }
+
+    const auto num_failed = std::count_if(errors.begin(),
+        errors.end(),
+        [](const std::optional<std::string> &err) { return err.has_value(); });
+    if (num_failed > 0) {
+      std::string msg{"Failed to load "};
+      msg += std::to_string(num_failed);
+      msg += " of ";
+      msg += std::to_string(fnames.size());
+      msg += " nested configuration files:";
+      for (std::size_t idx = 0; idx < fnames.size(); ++idx) {
+        if (errors[idx].has_value()) {
+          msg += "\n  `";
+          msg += fnames[idx];
+          msg += "`: ";
+          msg += errors[idx].value();
+        }
+      }
+      throw werkzeugkiste::config::ParseError{msg};
+    }
+
+    // Splice the loaded configurations into the parameter tree. List
+    // elements cannot be replaced by a group, thus the affected lists will
+    // be rebuilt (once per list).
+    werkzeugkiste::config::Configuration &mutable_cfg = MutableConfig();
+    std::unordered_map<std::string, ListElementReplacements> list_elements{};
+    for (const NestedSource &ref : references) {
+      const werkzeugkiste::config::Configuration &nested =
+          loaded[file_indices.at(ref.filename)];
+      if (ref.key.back() == ']') {
+        const std::size_t pos = ref.key.rfind('[');
+        list_elements[ref.key.substr(0, pos)].emplace(
+            std::stoul(ref.key.substr(pos + 1)), &nested);
+      } else {
+        mutable_cfg.Delete(ref.key);
+        mutable_cfg.SetGroup(ref.key, nested);
+      }
+    }
+
+    for (const auto &[list_key, elements] : list_elements) {
+      ReplaceListElements(mutable_cfg, list_key, elements);
+    }
+
+    // Remember the nested files, so that they can be watched for
+    // modifications.
+    data_->nested.insert(
+        data_->nested.end(), references.begin(), references.end());
+    return references.size();
+  }
+
+  /// @brief Starts monitoring the configuration file and all nested
+  ///   configuration files, see `ConfigWatcher`.
+  std::unique_ptr<PyConfigWatcher> Watch(const pybind11::function &callback,
+      std::chrono::milliseconds debounce,
+      const std::optional<pybind11::function> &on_error) const {
+    if (!fqn_prefix_.empty()) {
+      std::string msg{
+          "Only the root configuration can be watched, but this is a view "
+          "on `"};
+      msg += fqn_prefix_;
+      msg += "`!";
+      throw werkzeugkiste::config::ValueError{msg};
+    }
+    if (!data_->source.has_value()) {
+      throw werkzeugkiste::config::ValueError{
+          "Cannot watch a configuration which has not been loaded from a "
+          "file!"};
+    }
+
+    const ConfigSource &source = data_->source.value();
+    const std::vector<NestedSource> &nested = data_->nested;
+    // If a callback destroys the watcher, the callbacks will be released by
+    // the background thread.
+    auto on_reload = [callback = ShareWithGIL(callback), source, nested](
+                         werkzeugkiste::config::Configuration &&data,
+                         ParameterDiff &&diff) {
+      pybind11::gil_scoped_acquire acquire;
+      try {
+        // The reloaded configuration can be watched again.
+        Config cfg = FromConfiguration(std::move(data));
+        cfg.data_->source = source;
+        cfg.data_->nested = nested;
+
+        pybind11::set changed{};
+        for (const auto *keys : {&diff.added, &diff.removed, &diff.changed}) {
+          for (const std::string &key : *keys) {
+            changed.add(pybind11::str(key));
+          }
+        }
+        (*callback)(std::move(cfg), changed);
+      } catch (pybind11::error_already_set &e) {
+        e.discard_as_unraisable("ConfigWatcher callback");
+      }
+    };
+
+    auto report_error = [on_error = ShareWithGIL(on_error)](
+                            std::exception_ptr error) {
+      pybind11::gil_scoped_acquire acquire;
+      try {
+        // Let pybind11 translate the exception to its python equivalent.
+        pybind11::cpp_function([error]() { std::rethrow_exception(error); })();
+      } catch (pybind11::error_already_set &e) {
+        if (!on_error->has_value()) {
+          e.discard_as_unraisable("ConfigWatcher");
+          return;
+        }
+        try {
+          on_error->value()(e.value());
+        } catch (pybind11::error_already_set &err) {
+          err.discard_as_unraisable("ConfigWatcher error callback");
+        }
+      }
+    };
+
+    return std::make_unique<PyConfigWatcher>(source,
+        nested,
+        debounce,
+        std::move(on_reload),
+        std::move(report_error));
   }
 
   bool AdjustRelativePaths(pybind11::handle base_path,
       const std::vector<std::string_view> &parameters,
       std::string_view key) {
-    return MutableConfig().AdjustRelativePaths(
-        Key(key), PyObjToString(base_path), parameters);
+    const std::string fqn = Key(key);
+    return MutableConfig(fqn).AdjustRelativePaths(
+        fqn, PyObjToString(base_path), parameters);
   }
 
   inline const werkzeugkiste::config::Configuration &ImmutableConfig() const {
-    return data_->data;
+    using namespace std::string_view_literals;
+    Materialize(""sv);
+    return data_->shared ? *data_->shared : data_->data;
   }
 
  private:
   std::shared_ptr<DataHolder> data_{};
   std::string fqn_prefix_{};
 
+  /// @brief Creates a view onto the group/list `fqn_prefix` of the shared
+  ///   configuration data.
+  Config(std::shared_ptr<DataHolder> data, std::string fqn_prefix)
+      : data_{std::move(data)}, fqn_prefix_{std::move(fqn_prefix)} {}
+
   werkzeugkiste::config::Configuration CopyGroup(std::string_view fqn) const {
-    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig(fqn);
     if (fqn.empty()) {
       return cfg;
     }
@@ -671,10 +1476,255 @@ class Config {
     return CopyGroup(fqn_prefix_);
   }
 
+  /// @brief Returns the fingerprint of the viewed group/list if it has
+  ///   already been computed.
+  std::optional<std::uint64_t> CachedFingerprint() const {
+    const auto it = data_->fingerprints.find(fqn_prefix_);
+    if (it == data_->fingerprints.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  /// @brief Returns the configuration which holds the viewed group. Raises a
+  ///   TypeError if this is a view on a list.
+  const werkzeugkiste::config::Configuration &ViewedGroup() const {
+    const werkzeugkiste::config::Configuration &cfg =
+        ImmutableConfig(fqn_prefix_);
+    if (!fqn_prefix_.empty() &&
+        (cfg.Type(fqn_prefix_) != werkzeugkiste::config::ConfigType::Group)) {
+      std::string msg{"Only (sub-)groups can be compared, but `"};
+      msg += fqn_prefix_;
+      msg += "` is a `";
+      msg += werkzeugkiste::config::ConfigTypeToString(
+          cfg.Type(fqn_prefix_));
+      msg += "`!";
+      throw werkzeugkiste::config::TypeError{msg};
+    }
+    return cfg;
+  }
+
+  /// @brief Applies the patch in place, see `ApplyPatch`.
+  void ApplyPatchUnchecked(const pybind11::dict &patch) {
+    if (patch.contains("removed")) {
+      for (const auto &item : patch["removed"].cast<pybind11::dict>()) {
+        Delete(item.first.cast<std::string>());
+      }
+    }
+
+    if (patch.contains("changed")) {
+      for (const auto &item : patch["changed"].cast<pybind11::dict>()) {
+        const auto values = item.second.cast<pybind11::sequence>();
+        if (values.size() != 2) {
+          std::string msg{"Changed parameter `"};
+          msg += item.first.cast<std::string>();
+          msg += "` must be given as (previous, current) value pair!";
+          throw werkzeugkiste::config::ValueError{msg};
+        }
+        // The type of the parameter may have changed, too.
+        const std::string fqn = Key(item.first.cast<std::string>());
+        MutableConfig(fqn).Delete(fqn);
+        Set(fqn, values[1]);
+      }
+    }
+
+    if (patch.contains("added")) {
+      for (const auto &item : patch["added"].cast<pybind11::dict>()) {
+        Set(Key(item.first.cast<std::string>()), item.second);
+      }
+    }
+  }
+
+  /// @brief Serializes the viewed group/list to the given format.
+  ///
+  /// The root configuration is serialized in place. werkzeugkiste can only
+  /// serialize a complete configuration, thus views are serialized in place
+  /// by our own JSON writer (see `SerializeJSONGroup`), whereas the other
+  /// formats still require a copy of the viewed group (or the wrapped list,
+  /// see `CopyGroup`).
+  ///
+  /// If `release_gil` is set, the GIL is released while serializing. The
+  /// shared configuration cannot be modified meanwhile, see
+  /// `ReadOnlyScope`.
+  std::string SerializeViewed(std::string_view format,
+      bool release_gil = false) const {
+    if (!fqn_prefix_.empty() && (format != "json")) {
+      const werkzeugkiste::config::Configuration copy = CopyViewedGroup();
+      if (release_gil) {
+        pybind11::gil_scoped_release release;
+        return Serialize(copy, format);
+      }
+      return Serialize(copy, format);
+    }
+
+    if (!release_gil) {
+      return SerializeInPlace(ImmutableConfig(fqn_prefix_), format);
+    }
+    // Reading a lazily loaded configuration would modify it, thus it must be
+    // fully parsed before other threads may access it.
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+    ReadOnlyScope read_only{*data_};
+    pybind11::gil_scoped_release release;
+    return SerializeInPlace(cfg, format);
+  }
+
+  /// @brief Serializes the viewed group/list of `cfg`, which must be the
+  ///   shared configuration, without copying it. Views can only be
+  ///   serialized to JSON.
+  std::string SerializeInPlace(const werkzeugkiste::config::Configuration &cfg,
+      std::string_view format) const {
+    if (fqn_prefix_.empty()) {
+      return Serialize(cfg, format);
+    }
+
+    using namespace std::string_view_literals;
+    if (cfg.Type(fqn_prefix_) == werkzeugkiste::config::ConfigType::List) {
+      return SerializeJSONList(cfg, fqn_prefix_, "list"sv);
+    }
+    return SerializeJSONGroup(cfg, fqn_prefix_);
+  }
+
+  /// @brief Returns the serialization format for `dump`, deduced from the
+  ///   file extension (preceding `.gz`, if the output is compressed).
+  static std::string DumpFormatFromExtension(const std::string &filename) {
+    const std::string ext = ConfigFileExtension(filename);
+    if (ext == ".toml") {
+      return "toml";
+    }
+    if (ext == ".json") {
+      return "json";
+    }
+    if ((ext == ".yaml") || (ext == ".yml")) {
+      return "yaml";
+    }
+    if (ext == ".cfg") {
+      return "libconfig";
+    }
+
+    std::string msg{"Cannot deduce the output format from the extension of `"};
+    msg += filename;
+    msg += "`, please specify the `format` explicitly!";
+    throw werkzeugkiste::config::ValueError{msg};
+  }
+
+  static std::string Serialize(const werkzeugkiste::config::Configuration &cfg,
+      std::string_view format) {
+    if (format == "toml") {
+      return cfg.ToTOML();
+    }
+    if (format == "json") {
+      return cfg.ToJSON();
+    }
+    if (format == "yaml") {
+      return cfg.ToYAML();
+    }
+    if (format == "libconfig") {
+      return cfg.ToLibconfig();
+    }
+
+    std::string msg{"Unsupported output format `"};
+    msg += format;
+    msg += "`, expected one of `toml`, `json`, `yaml`, or `libconfig`!";
+    throw werkzeugkiste::config::ValueError{msg};
+  }
+
+  /// @brief Returns the configuration in which (at least) the parameter
+  ///   `fqn` has been parsed, see `Materialize`.
+  inline const werkzeugkiste::config::Configuration &ImmutableConfig(
+      std::string_view fqn) const {
+    Materialize(fqn);
+    return data_->shared ? *data_->shared : data_->data;
+  }
+
+  /// @brief Returns the configuration for an arbitrary modification, *i.e.*
+  ///   all cached fingerprints will be invalidated.
   inline werkzeugkiste::config::Configuration &MutableConfig() {
+    using namespace std::string_view_literals;
+    return MutableConfig(""sv);
+  }
+
+  /// @brief Returns the configuration to modify the parameter `fqn` (or its
+  ///   children). An empty `fqn` denotes an arbitrary modification.
+  inline werkzeugkiste::config::Configuration &MutableConfig(
+      std::string_view fqn) {
+    if (data_->frozen) {
+      throw werkzeugkiste::config::TypeError{
+          "Cannot modify a frozen configuration!"};
+    }
+    if (data_->num_readers_without_gil > 0) {
+      throw werkzeugkiste::config::TypeError{
+          "Cannot modify a configuration while it is being serialized!"};
+    }
+    if (data_->shared) {
+      data_->data = *data_->shared;
+      data_->shared.reset();
+    }
+    using namespace std::string_view_literals;
+    Materialize(""sv);
+    InvalidateFingerprints(data_->fingerprints, fqn);
     return data_->data;
   }
 
+  /// @brief Parses the pending top-level parameter of a lazily loaded
+  ///   configuration which is required to access `fqn`. An empty `fqn`
+  ///   requires the full configuration, *e.g.* to list all parameters or
+  ///   to modify the configuration.
+  void Materialize(std::string_view fqn) const {
+    if (!data_->lazy) {
+      return;
+    }
+
+    using namespace std::string_view_literals;
+    if (fqn.empty()) {
+      // Only the pending parameters are parsed. Nothing has been modified so
+      // far, thus the configuration only holds previously parsed top-level
+      // parameters. These are merged with the pending ones by copying the
+      // smaller set of top-level parameters.
+      werkzeugkiste::config::Configuration pending =
+          data_->lazy->TakePending();
+      data_->lazy.reset();
+      werkzeugkiste::config::Configuration &parsed = data_->data;
+      const bool copy_parsed = parsed.Size(""sv) <= pending.Size(""sv);
+      const werkzeugkiste::config::Configuration &src =
+          copy_parsed ? parsed : pending;
+      werkzeugkiste::config::Configuration &dst =
+          copy_parsed ? pending : parsed;
+      for (const std::string &key : src.ListParameterNames(""sv,
+               /*include_array_entries=*/false,
+               /*recursive=*/false)) {
+        CopyParameter(src, key, dst);
+      }
+      if (copy_parsed) {
+        data_->data = std::move(pending);
+      }
+      return;
+    }
+
+    const std::string_view key = fqn.substr(0, fqn.find_first_of(".["));
+    std::optional<werkzeugkiste::config::Configuration> parsed =
+        data_->lazy->Take(key);
+    if (data_->lazy->Empty()) {
+      data_->lazy.reset();
+    }
+    if (!parsed.has_value() || !parsed->Contains(key)) {
+      return;
+    }
+
+    if (data_->data.Size(""sv) == 0) {
+      data_->data = std::move(parsed.value());
+    } else {
+      CopyParameter(parsed.value(), key, data_->data);
+    }
+  }
+
+  /// @brief Remembers the configuration file, which is required to watch it
+  ///   for modifications.
+  template <typename Loader>
+  void SetSource(const std::string &filename, Loader &&load) {
+    data_->source =
+        ConfigSource{AbsoluteFilename(filename), std::forward<Loader>(load)};
+  }
+
   inline std::string Key(std::string_view key) const {
     std::string fqn{fqn_prefix_};
     if (!fqn_prefix_.empty() && !key.empty()) {
@@ -708,7 +1758,7 @@ class Config {
   }
 
   pybind11::list GetPyList(std::string_view fqn) const {
-    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig(fqn);
     if (cfg.Type(fqn) != werkzeugkiste::config::ConfigType::List) {
       std::string msg{"Cannot convert parameter `"};
       msg += fqn;
@@ -718,19 +1768,12 @@ class Config {
       throw werkzeugkiste::config::TypeError{msg};
     }
 
-    pybind11::list lst{};
-    const std::size_t num_el = cfg.Size(fqn);
-    for (std::size_t idx = 0; idx < num_el; ++idx) {
-      const std::string elem_key = 
-          werkzeugkiste::config::Configuration::KeyForListElement(
-            fqn, idx);
-      lst.append(ValueOr(cfg.Type(elem_key), elem_key, /*return_def=*/false));
-    }
-    return lst;
+    std::string key{fqn};
+    return pybind11::list(ParameterToPyObject(cfg, key));
   }
 
   pybind11::dict GetPyDict(std::string_view fqn) const {
-    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig(fqn);
     if (!fqn.empty() &&
         (cfg.Type(fqn) != werkzeugkiste::config::ConfigType::Group)) {
       std::string msg{"Cannot convert parameter `"};
@@ -741,24 +1784,15 @@ class Config {
       throw werkzeugkiste::config::TypeError{msg};
     }
 
-    pybind11::dict d{};
-    const std::string cfg_fqn_prefix =
-        fqn.empty() ? "" : (std::string(fqn) + '.');
-    const std::vector<std::string> keys = cfg.ListParameterNames(
-        fqn, /*include_array_entries=*/false, /*recursive=*/false);
-    for (const std::string &key : keys) {
-      const char *dkey = key.c_str();
-      const std::string cfg_key{cfg_fqn_prefix + key};
-      d[dkey] = ValueOr(cfg.Type(cfg_key), cfg_key, /*return_def=*/false);
-    }
-    return d;
+    std::string key{fqn};
+    return pybind11::dict(ParameterToPyObject(cfg, key));
   }
 
   pybind11::object ValueOr(werkzeugkiste::config::ConfigType type,
       std::string_view fqn,
       bool return_def,
       const pybind11::object &def = pybind11::none()) const {
-    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig(fqn);
     if (return_def && !cfg.Contains(fqn)) {
       return def;
     }
@@ -801,26 +1835,22 @@ class Config {
     throw std::logic_error{msg};
   }
 
-  pybind11::object GetBuiltinOrView(std::string_view fqn) {
-    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+  pybind11::object GetBuiltinOrView(std::string_view fqn) const {
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig(fqn);
     const werkzeugkiste::config::ConfigType type = cfg.Type(fqn);
 
     if ((type == werkzeugkiste::config::ConfigType::List) ||
         (type == werkzeugkiste::config::ConfigType::Group)) {
-      pybind11::object config_cls =
-          pybind11::module::import("pyzeugkiste._core._cfg").attr("Config");
-      pybind11::object obj = config_cls();
-      auto *ptr = obj.cast<Config *>();
-      ptr->data_ = data_;
-      ptr->fqn_prefix_ = fqn;
-      return obj;
+      // The view is moved into an instance of the registered python type,
+      // which neither requires a module import nor a throwaway DataHolder.
+      return pybind11::cast(Config{data_, std::string{fqn}});
     }
 
     return ValueOr(type, fqn, false);
   }
 
   pybind11::object GetBuiltinValue(std::string_view fqn) const {
-    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig();
+    const werkzeugkiste::config::Configuration &cfg = ImmutableConfig(fqn);
     const werkzeugkiste::config::ConfigType type = cfg.Type(fqn);
     return ValueOr(type, fqn, false);
   }
@@ -832,7 +1862,7 @@ class Config {
     using TpCfg =
         std::conditional_t<std::is_integral_v<TpNumpy>, int64_t, double>;
 
-    werkzeugkiste::config::Configuration &cfg = MutableConfig();
+    werkzeugkiste::config::Configuration &cfg = MutableConfig(fqn);
     if (cfg.EnsureTypeIfExists(fqn, werkzeugkiste::config::ConfigType::List)) {
       cfg.ClearList(fqn);
     } else {
@@ -918,71 +1948,85 @@ class Config {
   }
 
   void Set(std::string_view fqn, pybind11::handle value) {
-    werkzeugkiste::config::Configuration &cfg = MutableConfig();
-    const std::string py_typestr =
-        pybind11::cast<std::string>(value.attr("__class__").attr("__name__"));
-    std::optional<werkzeugkiste::config::ConfigType> existing_type{
-        std::nullopt};
+    werkzeugkiste::config::Configuration &cfg = MutableConfig(fqn);
+    // Python type defines what kind of parameter to insert:
+    switch (ClassifyPyValue(value)) {
+      case PyValueKind::String:
+        cfg.SetString(fqn, value.cast<std::string_view>());
+        return;
+
+      case PyValueKind::Boolean:
+        cfg.SetBool(fqn, value.cast<bool>());
+        return;
+
+      case PyValueKind::Integer:
+        cfg.SetInt64(fqn, value.cast<int64_t>());
+        return;
+
+      case PyValueKind::FloatingPoint:
+        cfg.SetDouble(fqn, value.cast<double>());
+        return;
+
+      case PyValueKind::Sequence:
+        if (cfg.Contains(fqn)) {
+          cfg.ClearList(fqn);
+        } else {
+          cfg.CreateList(fqn);
+        }
+        ExtractPyIterable(cfg, fqn, value);
+        return;
 
-    std::string err_msg{};
-    if (cfg.Contains(fqn)) {
-      existing_type = cfg.Type(fqn);
-      err_msg = "Cannot use a python object of type `";
-      err_msg += py_typestr;
-      err_msg += "` to update existing parameter `";
-      err_msg += fqn;
-      err_msg += "` of type `";
-      err_msg +=
-          werkzeugkiste::config::ConfigTypeToString(existing_type.value());
-      err_msg += "`!";
-    } else {
-      err_msg = "Cannot create parameter `";
-      err_msg += fqn;
-      err_msg += "` from python type `";
-      err_msg += py_typestr;
-      err_msg += "`!";
-    }
+      case PyValueKind::Dict:
+        cfg.SetGroup(fqn,
+            PyDictToConfiguration(
+                pybind11::reinterpret_borrow<pybind11::dict>(value)));
+        return;
 
-    // Python type defines what kind of parameter to insert:
-    if (pybind11::isinstance<pybind11::str>(value)) {
-      cfg.SetString(fqn, value.cast<std::string>());
-    } else if (pybind11::isinstance<pybind11::bool_>(value)) {
-      cfg.SetBool(fqn, value.cast<bool>());
-    } else if (pybind11::isinstance<pybind11::int_>(value)) {
-      cfg.SetInt64(fqn, value.cast<int64_t>());
-    } else if (pybind11::isinstance<pybind11::float_>(value)) {
-      cfg.SetDouble(fqn, value.cast<double>());
-    } else if (pybind11::isinstance<pybind11::list>(value) ||
-               pybind11::isinstance<pybind11::tuple>(value)) {
-      if (cfg.Contains(fqn)) {
-        cfg.ClearList(fqn);
-      } else {
-        cfg.CreateList(fqn);
-      }
-      ExtractPyIterable(cfg, fqn, value);
-    } else if (pybind11::isinstance<pybind11::dict>(value)) {
-      cfg.SetGroup(fqn, PyDictToConfiguration(value.cast<pybind11::dict>()));
-    } else if (pybind11::isinstance<Config>(value)) {
-      cfg.SetGroup(fqn, value.cast<Config>().ImmutableConfig());
-    } else if (pybind11::isinstance<pybind11::array>(value)) {
-      SetMatrix(fqn, value.cast<pybind11::array>());
-    } else {
-      if (py_typestr.compare("date") == 0) {
+      case PyValueKind::Config:
+        cfg.SetGroup(fqn, value.cast<const Config &>().ImmutableConfig());
+        return;
+
+      case PyValueKind::Array:
+        SetMatrix(fqn, pybind11::reinterpret_borrow<pybind11::array>(value));
+        return;
+
+      case PyValueKind::Date:
         cfg.SetDate(fqn, PyObjToDate(value));
-      } else if (py_typestr.compare("time") == 0) {
+        return;
+
+      case PyValueKind::Time:
         cfg.SetTime(fqn, PyObjToTime(value));
-      } else if (py_typestr.compare("datetime") == 0) {
+        return;
+
+      case PyValueKind::DateTime:
         cfg.SetDateTime(fqn, PyObjToDateTime(value));
-      } else {
-        throw werkzeugkiste::config::TypeError{err_msg};
-      }
+        return;
+
+      case PyValueKind::Unsupported:
+        break;
     }
+
+    std::string msg{};
+    if (cfg.Contains(fqn)) {
+      msg = "Cannot use a python object of type `";
+      msg += PyTypeName(value);
+      msg += "` to update existing parameter `";
+      msg += fqn;
+      msg += "` of type `";
+      msg += werkzeugkiste::config::ConfigTypeToString(cfg.Type(fqn));
+      msg += "`!";
+    } else {
+      msg = "Cannot create parameter `";
+      msg += fqn;
+      msg += "` from python type `";
+      msg += PyTypeName(value);
+      msg += "`!";
+    }
+    throw werkzeugkiste::config::TypeError{msg};
   }
 
   void AppendToList(std::string_view fqn, pybind11::handle value) {
-    werkzeugkiste::config::Configuration &cfg = MutableConfig();
-    const std::string py_typestr =
-        pybind11::cast<std::string>(value.attr("__class__").attr("__name__"));
+    werkzeugkiste::config::Configuration &cfg = MutableConfig(fqn);
 
     if (fqn.empty()) {
       throw werkzeugkiste::config::TypeError{
@@ -1004,42 +2048,66 @@ class Config {
       }
     }
 
-    if (pybind11::isinstance<pybind11::str>(value)) {
-      cfg.Append(fqn, value.cast<std::string>());
-    } else if (pybind11::isinstance<pybind11::bool_>(value)) {
-      cfg.Append(fqn, value.cast<bool>());
-    } else if (pybind11::isinstance<pybind11::int_>(value)) {
-      cfg.Append(fqn, value.cast<int64_t>());
-    } else if (pybind11::isinstance<pybind11::float_>(value)) {
-      cfg.Append(fqn, value.cast<double>());
-    } else if (pybind11::isinstance<pybind11::list>(value) ||
-               pybind11::isinstance<pybind11::tuple>(value)) {
-      const std::size_t size_list = cfg.Size(fqn);
-      const std::string fqn_nested =
-          werkzeugkiste::config::Configuration::KeyForListElement(
-            fqn, size_list);
-      cfg.AppendList(fqn);
-      ExtractPyIterable(cfg, fqn_nested, value);
-    } else if (pybind11::isinstance<pybind11::dict>(value)) {
-      cfg.Append(fqn, PyDictToConfiguration(value.cast<pybind11::dict>()));
-    } else if (pybind11::isinstance<Config>(value)) {
-      cfg.Append(fqn, value.cast<Config>().ImmutableConfig());
-    } else {
-      if (py_typestr.compare("date") == 0) {
+    switch (ClassifyPyValue(value)) {
+      case PyValueKind::String:
+        cfg.Append(fqn, value.cast<std::string_view>());
+        return;
+
+      case PyValueKind::Boolean:
+        cfg.Append(fqn, value.cast<bool>());
+        return;
+
+      case PyValueKind::Integer:
+        cfg.Append(fqn, value.cast<int64_t>());
+        return;
+
+      case PyValueKind::FloatingPoint:
+        cfg.Append(fqn, value.cast<double>());
+        return;
+
+      case PyValueKind::Sequence: {
+        const std::size_t size_list = cfg.Size(fqn);
+        const std::string fqn_nested =
+            werkzeugkiste::config::Configuration::KeyForListElement(
+              fqn, size_list);
+        cfg.AppendList(fqn);
+        ExtractPyIterable(cfg, fqn_nested, value);
+        return;
+      }
+
+      case PyValueKind::Dict:
+        cfg.Append(fqn,
+            PyDictToConfiguration(
+                pybind11::reinterpret_borrow<pybind11::dict>(value)));
+        return;
+
+      case PyValueKind::Config:
+        cfg.Append(fqn, value.cast<const Config &>().ImmutableConfig());
+        return;
+
+      case PyValueKind::Date:
         cfg.Append(fqn, PyObjToDate(value));
-      } else if (py_typestr.compare("time") == 0) {
+        return;
+
+      case PyValueKind::Time:
         cfg.Append(fqn, PyObjToTime(value));
-      } else if (py_typestr.compare("datetime") == 0) {
+        return;
+
+      case PyValueKind::DateTime:
         cfg.Append(fqn, PyObjToDateTime(value));
-      } else {
-        std::string msg{"Cannot append python object of type `"};
-        msg += py_typestr;
-        msg += "` to parameter list `";
-        msg += fqn;
-        msg += "`!";
-        throw werkzeugkiste::config::TypeError{msg};
-      }
+        return;
+
+      case PyValueKind::Array:
+      case PyValueKind::Unsupported:
+        break;
     }
+
+    std::string msg{"Cannot append python object of type `"};
+    msg += PyTypeName(value);
+    msg += "` to parameter list `";
+    msg += fqn;
+    msg += "`!";
+    throw werkzeugkiste::config::TypeError{msg};
   }
 };
 
@@ -1057,44 +2125,66 @@ inline void ExtractPyIterable(werkzeugkiste::config::Configuration &cfg,
 
   // Invoked with either list or tuple
   for (pybind11::handle value : lst) {
-    const std::string tp =
-        pybind11::cast<std::string>(value.attr("__class__").attr("__name__"));
-
-    if (pybind11::isinstance<pybind11::str>(value)) {
-      cfg.Append(key, value.cast<std::string>());
-    } else if (pybind11::isinstance<pybind11::bool_>(value)) {
-      cfg.Append(key, value.cast<bool>());
-    } else if (pybind11::isinstance<pybind11::int_>(value)) {
-      cfg.Append(key, value.cast<int64_t>());
-    } else if (pybind11::isinstance<pybind11::float_>(value)) {
-      cfg.Append(key, value.cast<double>());
-    } else if (pybind11::isinstance<pybind11::list>(value)) {
-      const std::size_t size_list = cfg.Size(key);
-      const std::string elem_key =
-          werkzeugkiste::config::Configuration::KeyForListElement(
-            key, size_list);
-      cfg.AppendList(key);
-      ExtractPyIterable(cfg, elem_key, value);
-    } else if (pybind11::isinstance<Config>(value)) {
-      cfg.Append(key, value.cast<Config>().ImmutableConfig());
-    } else if (pybind11::isinstance<pybind11::dict>(value)) {
-      cfg.Append(key, PyDictToConfiguration(value.cast<pybind11::dict>()));
-    } else {
-      if (tp.compare("date") == 0) {
+    switch (ClassifyPyValue(value)) {
+      case PyValueKind::String:
+        cfg.Append(key, value.cast<std::string_view>());
+        continue;
+
+      case PyValueKind::Boolean:
+        cfg.Append(key, value.cast<bool>());
+        continue;
+
+      case PyValueKind::Integer:
+        cfg.Append(key, value.cast<int64_t>());
+        continue;
+
+      case PyValueKind::FloatingPoint:
+        cfg.Append(key, value.cast<double>());
+        continue;
+
+      case PyValueKind::Sequence: {
+        const std::size_t size_list = cfg.Size(key);
+        const std::string elem_key =
+            werkzeugkiste::config::Configuration::KeyForListElement(
+              key, size_list);
+        cfg.AppendList(key);
+        ExtractPyIterable(cfg, elem_key, value);
+        continue;
+      }
+
+      case PyValueKind::Dict:
+        cfg.Append(key,
+            PyDictToConfiguration(
+                pybind11::reinterpret_borrow<pybind11::dict>(value)));
+        continue;
+
+      case PyValueKind::Config:
+        cfg.Append(key, value.cast<const Config &>().ImmutableConfig());
+        continue;
+
+      case PyValueKind::Date:
         cfg.Append(key, PyObjToDate(value));
-      } else if (tp.compare("time") == 0) {
+        continue;
+
+      case PyValueKind::Time:
         cfg.Append(key, PyObjToTime(value));
-      } else if (tp.compare("datetime") == 0) {
+        continue;
+
+      case PyValueKind::DateTime:
         cfg.Append(key, PyObjToDateTime(value));
-      } else {
-        std::string msg{"Cannot append a python object of type `"};
-        msg += tp;
-        msg += "` to list `";
-        msg += key;
-        msg += "`!";
-        throw werkzeugkiste::config::TypeError{msg};
-      }
+        continue;
+
+      case PyValueKind::Array:
+      case PyValueKind::Unsupported:
+        break;
     }
+
+    std::string msg{"Cannot append a python object of type `"};
+    msg += PyTypeName(value);
+    msg += "` to list `";
+    msg += key;
+    msg += "`!";
+    throw werkzeugkiste::config::TypeError{msg};
   }
 }
 
@@ -1102,16 +2192,15 @@ inline werkzeugkiste::config::Configuration PyDictToConfiguration(
     const pybind11::dict &d) {
   werkzeugkiste::config::Configuration cfg{};
   for (std::pair<pybind11::handle, pybind11::handle> item : d) {
-    if (!pybind11::isinstance<pybind11::str>(item.first)) {
+    if (!PyUnicode_Check(item.first.ptr())) {
       std::string msg{
           "Dictionary keys must be strings in order to convert to a "
           "configuration parameter, but got `"};
-      msg += pybind11::cast<std::string>(
-          item.first.attr("__class__").attr("__name__"));
+      msg += PyTypeName(item.first);
       msg += "`!";
       throw werkzeugkiste::config::TypeError{msg};
     }
-    const std::string key = item.first.cast<std::string>();
+    const auto key = item.first.cast<std::string_view>();
 
     if (!werkzeugkiste::config::IsValidKey(key, /*allow_dots=*/false)) {
       std::string msg{"Dictionary key `"};
@@ -1122,45 +2211,153 @@ inline werkzeugkiste::config::Configuration PyDictToConfiguration(
       throw werkzeugkiste::config::TypeError{msg};
     }
 
-    if (pybind11::isinstance<pybind11::str>(item.second)) {
-      cfg.SetString(key, item.second.cast<std::string>());
-    } else if (pybind11::isinstance<pybind11::bool_>(item.second)) {
-      cfg.SetBool(key, item.second.cast<bool>());
-    } else if (pybind11::isinstance<pybind11::int_>(item.second)) {
-      cfg.SetInt64(key, item.second.cast<int64_t>());
-    } else if (pybind11::isinstance<pybind11::float_>(item.second)) {
-      cfg.SetDouble(key, item.second.cast<double>());
-    } else if (pybind11::isinstance<pybind11::list>(item.second) ||
-               pybind11::isinstance<pybind11::tuple>(item.second)) {
-      cfg.CreateList(key);
-      ExtractPyIterable(cfg, key, item.second);
-    } else if (pybind11::isinstance<Config>(item.second)) {
-      cfg.SetGroup(key, item.second.cast<Config>().ImmutableConfig());
-    } else if (pybind11::isinstance<pybind11::dict>(item.second)) {
-      cfg.SetGroup(
-          key, PyDictToConfiguration(item.second.cast<pybind11::dict>()));
-    } else {
-      const std::string tp = pybind11::cast<std::string>(
-          item.second.attr("__class__").attr("__name__"));
-      if (tp.compare("date") == 0) {
+    switch (ClassifyPyValue(item.second)) {
+      case PyValueKind::String:
+        cfg.SetString(key, item.second.cast<std::string_view>());
+        continue;
+
+      case PyValueKind::Boolean:
+        cfg.SetBool(key, item.second.cast<bool>());
+        continue;
+
+      case PyValueKind::Integer:
+        cfg.SetInt64(key, item.second.cast<int64_t>());
+        continue;
+
+      case PyValueKind::FloatingPoint:
+        cfg.SetDouble(key, item.second.cast<double>());
+        continue;
+
+      case PyValueKind::Sequence:
+        cfg.CreateList(key);
+        ExtractPyIterable(cfg, key, item.second);
+        continue;
+
+      case PyValueKind::Dict:
+        cfg.SetGroup(key,
+            PyDictToConfiguration(
+                pybind11::reinterpret_borrow<pybind11::dict>(item.second)));
+        continue;
+
+      case PyValueKind::Config:
+        cfg.SetGroup(
+            key, item.second.cast<const Config &>().ImmutableConfig());
+        continue;
+
+      case PyValueKind::Date:
         cfg.SetDate(key, PyObjToDate(item.second));
-      } else if (tp.compare("time") == 0) {
+        continue;
+
+      case PyValueKind::Time:
         cfg.SetTime(key, PyObjToTime(item.second));
-      } else if (tp.compare("datetime") == 0) {
+        continue;
+
+      case PyValueKind::DateTime:
         cfg.SetDateTime(key, PyObjToDateTime(item.second));
-      } else {
-        std::string msg{"Cannot convert a python object of type `"};
-        msg += tp;
-        msg += "` to a configuration parameter. Check dictionary key `";
-        msg += key;
-        msg += "`!";
-        throw werkzeugkiste::config::TypeError{msg};
-      }
+        continue;
+
+      case PyValueKind::Array:
+      case PyValueKind::Unsupported:
+        break;
     }
+
+    std::string msg{"Cannot convert a python object of type `"};
+    msg += PyTypeName(item.second);
+    msg += "` to a configuration parameter. Check dictionary key `";
+    msg += key;
+    msg += "`!";
+    throw werkzeugkiste::config::TypeError{msg};
   }
   return cfg;
 }
 
+/// @brief Returns true if the python object equals the parameter `key` of
+///   `cfg`. An empty key denotes the root group.
+///
+/// Dictionaries and lists/tuples are compared element-wise without
+/// converting them to a configuration, *i.e.* the comparison stops at the
+/// first mismatch. The key buffer will be restored before returning.
+inline bool PyObjEqualsParameter(
+    const werkzeugkiste::config::Configuration &cfg,
+    std::string &key,
+    pybind11::handle value) {
+  using werkzeugkiste::config::ConfigType;
+  const ConfigType type = key.empty() ? ConfigType::Group : cfg.Type(key);
+
+  if (pybind11::isinstance<pybind11::dict>(value)) {
+    const auto d = pybind11::reinterpret_borrow<pybind11::dict>(value);
+    if ((type != ConfigType::Group) || (d.size() != cfg.Size(key))) {
+      return false;
+    }
+    const std::size_t len = key.length();
+    for (std::pair<pybind11::handle, pybind11::handle> item : d) {
+      if (!pybind11::isinstance<pybind11::str>(item.first)) {
+        return false;
+      }
+      const auto name = item.first.cast<std::string_view>();
+      if (!werkzeugkiste::config::IsValidKey(name, /*allow_dots=*/false)) {
+        return false;
+      }
+      AppendParameterName(key, name);
+      const bool equal =
+          cfg.Contains(key) && PyObjEqualsParameter(cfg, key, item.second);
+      key.resize(len);
+      if (!equal) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (pybind11::isinstance<pybind11::list>(value) ||
+      pybind11::isinstance<pybind11::tuple>(value)) {
+    const auto seq = pybind11::reinterpret_borrow<pybind11::sequence>(value);
+    const std::size_t num_el = seq.size();
+    if ((type != ConfigType::List) || (num_el != cfg.Size(key))) {
+      return false;
+    }
+    const std::size_t len = key.length();
+    for (std::size_t idx = 0; idx < num_el; ++idx) {
+      AppendListIndex(key, idx);
+      const bool equal = PyObjEqualsParameter(cfg, key, seq[idx]);
+      key.resize(len);
+      if (!equal) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  if (pybind11::isinstance<Config>(value)) {
+    return value.cast<const Config &>().EqualsParameter(cfg, key);
+  }
+
+  if (pybind11::isinstance<pybind11::str>(value)) {
+    return (type == ConfigType::String) &&
+           (cfg.GetString(key) == value.cast<std::string_view>());
+  }
+  if (pybind11::isinstance<pybind11::bool_>(value)) {
+    return (type == ConfigType::Boolean) &&
+           (cfg.GetBool(key) == value.cast<bool>());
+  }
+  if (pybind11::isinstance<pybind11::int_>(value)) {
+    return (type == ConfigType::Integer) &&
+           (cfg.GetInt64(key) == value.cast<int64_t>());
+  }
+  if (pybind11::isinstance<pybind11::float_>(value)) {
+    return (type == ConfigType::FloatingPoint) &&
+           (cfg.GetDouble(key) == value.cast<double>());
+  }
+
+  // Other types (i.e. date/time) are converted as usual.
+  pybind11::dict tmp{};
+  tmp["value"] = value;
+  const werkzeugkiste::config::Configuration converted =
+      PyDictToConfiguration(tmp);
+  std::string converted_key{"value"};
+  return ParametersEqual(cfg, key, converted, converted_key);
+}
+
 inline werkzeugkiste::config::date PyObjToDateUnchecked(pybind11::handle obj) {
   const int year = obj.attr("year").cast<int>();
   const int month = obj.attr("month").cast<int>();
@@ -1274,44 +2471,91 @@ inline werkzeugkiste::config::date_time PyObjToDateTime(pybind11::handle obj) {
   throw werkzeugkiste::config::TypeError(msg);
 }
 
+inline void EnsurePyDateTimeImported() {
+  // We need to ensure that the PyDateTime import is initialized.
+  // Or prepare for segfaults.
+  if (!PyDateTimeAPI) {
+    PyDateTime_IMPORT;
+    if (!PyDateTimeAPI) {
+      throw pybind11::error_already_set();
+    }
+  }
+}
+
+/// Returns a borrowed reference to the `datetime.timezone` for the given
+/// UTC offset. Timezone objects are cached per offset, because typical
+/// configurations only use a handful of different offsets.
+inline PyObject *PyTimeZoneForOffset(int32_t offset_minutes) {
+  if (offset_minutes == 0) {
+    return PyDateTime_TimeZone_UTC;
+  }
+
+  // The cached timezones are intentionally never released: they must outlive
+  // this static map, which would otherwise be destroyed after the interpreter
+  // has already been finalized. Access is serialized by the GIL.
+  static std::unordered_map<int32_t, PyObject *> cache;
+  const auto it = cache.find(offset_minutes);
+  if (it != cache.end()) {
+    return it->second;
+  }
+
+  pybind11::object delta = pybind11::reinterpret_steal<pybind11::object>(
+      PyDelta_FromDSU(0, offset_minutes * 60, 0));
+  if (!delta) {
+    throw pybind11::error_already_set();
+  }
+  PyObject *tz = PyTimeZone_FromOffset(delta.ptr());
+  if (tz == nullptr) {
+    throw pybind11::error_already_set();
+  }
+  cache.emplace(offset_minutes, tz);
+  return tz;
+}
+
 inline pybind11::object DateToPyObj(const werkzeugkiste::config::date &d) {
-  auto pydatetime = pybind11::module::import("datetime");
-  return pydatetime.attr("date")(d.year, d.month, d.day);
+  EnsurePyDateTimeImported();
+  pybind11::object obj = pybind11::reinterpret_steal<pybind11::object>(
+      PyDate_FromDate(d.year, d.month, d.day));
+  if (!obj) {
+    throw pybind11::error_already_set();
+  }
+  return obj;
 }
 
 inline pybind11::object TimeToPyObj(const werkzeugkiste::config::time &t) {
-  auto pydatetime = pybind11::module::import("datetime");
-  return pydatetime.attr("time")(
-      t.hour, t.minute, t.second, t.nanosecond / 1000);
+  EnsurePyDateTimeImported();
+  pybind11::object obj =
+      pybind11::reinterpret_steal<pybind11::object>(PyTime_FromTime(t.hour,
+          t.minute,
+          t.second,
+          static_cast<int>(t.nanosecond / 1000)));
+  if (!obj) {
+    throw pybind11::error_already_set();
+  }
+  return obj;
 }
 
 inline pybind11::object DateTimeToPyObj(
     const werkzeugkiste::config::date_time &dt) {
-  auto pydatetime = pybind11::module::import("datetime");
-  if (dt.IsLocal()) {
-    return pydatetime.attr("datetime")(dt.date.year,
-        dt.date.month,
-        dt.date.day,
-        dt.time.hour,
-        dt.time.minute,
-        dt.time.second,
-        dt.time.nanosecond / 1000);
-  }
-
-  auto timedelta = pydatetime.attr("timedelta");
-  auto timezone = pydatetime.attr("timezone");
-  // Ctor parameter order is: (days=0, seconds=0, microseconds=0,
-  //   milliseconds=0, minutes=0, hours=0, weeks=0)
-  // https://docs.python.org/3/library/datetime.html#datetime.timedelta
-  auto offset_td = timedelta(0, 0, 0, 0, dt.offset.value().minutes);
-  return pydatetime.attr("datetime")(dt.date.year,
-      dt.date.month,
-      dt.date.day,
-      dt.time.hour,
-      dt.time.minute,
-      dt.time.second,
-      dt.time.nanosecond / 1000,
-      timezone(offset_td));
+  EnsurePyDateTimeImported();
+  PyObject *tzinfo =
+      dt.IsLocal() ? Py_None : PyTimeZoneForOffset(dt.offset.value().minutes);
+  // Use the constructor from the C API capsule, as the convenience macro
+  // PyDateTime_FromDateAndTime does not accept a tzinfo object.
+  pybind11::object obj = pybind11::reinterpret_steal<pybind11::object>(
+      PyDateTimeAPI->DateTime_FromDateAndTime(dt.date.year,
+          dt.date.month,
+          dt.date.day,
+          dt.time.hour,
+          dt.time.minute,
+          dt.time.second,
+          static_cast<int>(dt.time.nanosecond / 1000),
+          tzinfo,
+          PyDateTimeAPI->DateTimeType));
+  if (!obj) {
+    throw pybind11::error_already_set();
+  }
+  return obj;
 }
 
 inline std::string PyObjToString(pybind11::handle hnd) {
@@ -1321,6 +2565,76 @@ inline std::string PyObjToString(pybind11::handle hnd) {
     return pybind11::str(hnd).cast<std::string>();
   }
 }
+
+inline std::string PyTypeName(pybind11::handle obj) {
+  return pybind11::cast<std::string>(obj.get_type().attr("__name__"));
+}
+
+inline PyValueKind ClassifyPyValue(pybind11::handle value) {
+  // Exact built-in types first, as they are the most common ones.
+  const PyTypeObject *type = Py_TYPE(value.ptr());
+  if (type == &PyUnicode_Type) {
+    return PyValueKind::String;
+  }
+  if (type == &PyBool_Type) {
+    return PyValueKind::Boolean;
+  }
+  if (type == &PyLong_Type) {
+    return PyValueKind::Integer;
+  }
+  if (type == &PyFloat_Type) {
+    return PyValueKind::FloatingPoint;
+  }
+  if ((type == &PyList_Type) || (type == &PyTuple_Type)) {
+    return PyValueKind::Sequence;
+  }
+  if (type == &PyDict_Type) {
+    return PyValueKind::Dict;
+  }
+
+  // The datetime C-API caches the type objects.
+  if (!PyDateTimeAPI) {
+    PyDateTime_IMPORT;
+  }
+  if (type == PyDateTimeAPI->DateType) {
+    return PyValueKind::Date;
+  }
+  if (type == PyDateTimeAPI->TimeType) {
+    return PyValueKind::Time;
+  }
+  if (type == PyDateTimeAPI->DateTimeType) {
+    return PyValueKind::DateTime;
+  }
+
+  // Fall back to (slower) instance checks, e.g. for subclasses such as
+  // numpy.float64.
+  if (pybind11::isinstance<Config>(value)) {
+    return PyValueKind::Config;
+  }
+  if (pybind11::isinstance<pybind11::array>(value)) {
+    return PyValueKind::Array;
+  }
+  PyObject *ptr = value.ptr();
+  if (PyUnicode_Check(ptr)) {
+    return PyValueKind::String;
+  }
+  if (PyLong_Check(ptr)) {
+    return PyValueKind::Integer;
+  }
+  if (PyFloat_Check(ptr)) {
+    return PyValueKind::FloatingPoint;
+  }
+  if (PyList_Check(ptr) || PyTuple_Check(ptr)) {
+    return PyValueKind::Sequence;
+  }
+  if (PyDict_Check(ptr)) {
+    return PyValueKind::Dict;
+  }
+  if (PyDateTime_Check(ptr)) {
+    return PyValueKind::DateTime;
+  }
+  return PyValueKind::Unsupported;
+}
 }  // namespace werkzeugkiste::bindings::detail
 
 #endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_TYPES_H
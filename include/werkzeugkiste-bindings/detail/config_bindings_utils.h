@@ -0,0 +1,75 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_UTILS_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_UTILS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief Returns the number of worker threads to use for `num_items` tasks.
+///
+/// @param num_items Number of independent tasks.
+/// @param num_threads Requested number of threads. If 0, the number of
+///   hardware threads will be used.
+inline std::size_t NumWorkerThreads(std::size_t num_items,
+    std::size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+  }
+  return std::max<std::size_t>(1, std::min(num_threads, num_items));
+}
+
+/// @brief Invokes `fn(idx)` for each index in `[0, num_items)` on a
+///   temporary pool of worker threads.
+///
+/// The calling thread participates in the work. Thus, `fn` must not require
+/// the GIL, and the caller should release it before invoking `ParallelFor`.
+/// If any invocation throws, the remaining tasks are still processed and the
+/// first exception will be rethrown after all workers finished.
+///
+/// @param num_items Number of tasks.
+/// @param num_threads Maximum number of threads, 0 to use all hardware
+///   threads.
+/// @param fn Callable with signature `void(std::size_t idx)`.
+template <typename Fn>
+void ParallelFor(std::size_t num_items, std::size_t num_threads, Fn &&fn) {
+  std::atomic<std::size_t> next_idx{0};
+  std::exception_ptr first_error{};
+  std::mutex error_mutex{};
+
+  auto worker = [&]() {
+    for (std::size_t idx = next_idx++; idx < num_items; idx = next_idx++) {
+      try {
+        fn(idx);
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock{error_mutex};
+        if (!first_error) {
+          first_error = std::current_exception();
+        }
+      }
+    }
+  };
+
+  const std::size_t pool_size = NumWorkerThreads(num_items, num_threads);
+  std::vector<std::thread> threads{};
+  threads.reserve(pool_size - 1);
+  for (std::size_t i = 1; i < pool_size; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+}
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_UTILS_H
@@ -0,0 +1,477 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_WATCH_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_WATCH_H
+
+#include <werkzeugkiste/config/configuration.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_diff.h>
+#include <werkzeugkiste-bindings/detail/config_bindings_io.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#define PYZEUGKISTE_HAS_INOTIFY
+#endif
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief Describes how a configuration has been loaded from a file.
+struct ConfigSource {
+  /// @brief Absolute path to the configuration file.
+  std::string filename{};
+
+  /// @brief Parses the configuration file.
+  std::function<werkzeugkiste::config::Configuration(const std::string &)>
+      load{};
+};
+
+/// @brief A configuration file which has been loaded into parameter `key`
+///   via `LoadNestedConfiguration`.
+struct NestedSource {
+  /// @brief Fully qualified name of the parameter.
+  std::string key{};
+
+  /// @brief Absolute path to the nested configuration file.
+  std::string filename{};
+};
+
+/// @brief Returns the absolute, normalized path of `filename`, or the
+///   unmodified input if it cannot be resolved.
+inline std::string AbsoluteFilename(const std::string &filename) {
+  std::error_code ec{};
+  const std::filesystem::path absolute =
+      std::filesystem::absolute(filename, ec);
+  if (ec) {
+    return filename;
+  }
+  const std::filesystem::path normalized =
+      std::filesystem::weakly_canonical(absolute, ec);
+  return ec ? absolute.string() : normalized.string();
+}
+
+/// @brief Reports modifications of a set of files.
+///
+/// Instead of the files themselves, their parent directories are monitored.
+/// Thus, changes are also detected if an editor replaces a file, *i.e.*
+/// writes a temporary file and renames it afterwards.
+/// Currently, only Linux (inotify) is supported.
+class FileMonitor {
+ public:
+  /// @brief Starts monitoring the given files (absolute paths).
+  explicit FileMonitor(const std::vector<std::string> &filenames) {
+#ifdef PYZEUGKISTE_HAS_INOTIFY
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    interrupt_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if ((inotify_fd_ < 0) || (interrupt_fd_ < 0)) {
+      CloseDescriptors();
+      throw std::runtime_error{"Cannot initialize the file monitor!"};
+    }
+
+    constexpr uint32_t kEventMask =
+        IN_CLOSE_WRITE | IN_CREATE | IN_MODIFY | IN_MOVED_TO;
+    std::set<std::string> watched_dirs{};
+    for (const std::string &fname : filenames) {
+      files_.insert(fname);
+      const std::string dir =
+          std::filesystem::path{fname}.parent_path().string();
+      if (!watched_dirs.insert(dir).second) {
+        continue;
+      }
+
+      const int wd = inotify_add_watch(inotify_fd_, dir.c_str(), kEventMask);
+      if (wd < 0) {
+        CloseDescriptors();
+        std::string msg{"Cannot monitor directory `"};
+        msg += dir;
+        msg += "`!";
+        throw std::runtime_error{msg};
+      }
+      directories_[wd] = dir;
+    }
+#else   // PYZEUGKISTE_HAS_INOTIFY
+    (void)filenames;
+    throw std::runtime_error{
+        "Monitoring configuration files is only supported on Linux!"};
+#endif  // PYZEUGKISTE_HAS_INOTIFY
+  }
+
+  ~FileMonitor() { CloseDescriptors(); }
+
+  FileMonitor(const FileMonitor &) = delete;
+  FileMonitor &operator=(const FileMonitor &) = delete;
+  FileMonitor(FileMonitor &&) = delete;
+  FileMonitor &operator=(FileMonitor &&) = delete;
+
+  /// @brief Blocks until at least one of the monitored files has been
+  ///   modified and returns the modified files.
+  ///
+  /// Returns an empty set if the timeout expired (if set), or if `Interrupt`
+  /// has been called.
+  std::set<std::string> Wait(std::optional<std::chrono::milliseconds> timeout) {
+    std::set<std::string> changed{};
+#ifdef PYZEUGKISTE_HAS_INOTIFY
+    const auto deadline = std::chrono::steady_clock::now() +
+                          timeout.value_or(std::chrono::milliseconds{0});
+    while (changed.empty()) {
+      int timeout_ms = -1;
+      if (timeout.has_value()) {
+        const auto remaining =
+            std::chrono::ceil<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0) {
+          break;
+        }
+        timeout_ms = static_cast<int>(remaining.count());
+      }
+
+      pollfd fds[2] = {{inotify_fd_, POLLIN, 0}, {interrupt_fd_, POLLIN, 0}};
+      const int ret = poll(fds, 2, timeout_ms);
+      if (ret < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        throw std::runtime_error{"Failed to wait for file system events!"};
+      }
+      // The interrupt event is never reset, i.e. all subsequent calls
+      // return immediately.
+      if ((ret == 0) || ((fds[1].revents & POLLIN) != 0)) {
+        break;
+      }
+      if ((fds[0].revents & POLLIN) != 0) {
+        ReadEvents(changed);
+      }
+    }
+#else   // PYZEUGKISTE_HAS_INOTIFY
+    (void)timeout;
+#endif  // PYZEUGKISTE_HAS_INOTIFY
+    return changed;
+  }
+
+  /// @brief Wakes up a thread waiting in `Wait`.
+  void Interrupt() {
+#ifdef PYZEUGKISTE_HAS_INOTIFY
+    const uint64_t value{1};
+    [[maybe_unused]] const ssize_t ret =
+        write(interrupt_fd_, &value, sizeof(value));
+#endif  // PYZEUGKISTE_HAS_INOTIFY
+  }
+
+ private:
+  int inotify_fd_{-1};
+  int interrupt_fd_{-1};
+  std::unordered_map<int, std::string> directories_{};
+  std::set<std::string> files_{};
+
+  void CloseDescriptors() {
+#ifdef PYZEUGKISTE_HAS_INOTIFY
+    if (inotify_fd_ >= 0) {
+      close(inotify_fd_);
+      inotify_fd_ = -1;
+    }
+    if (interrupt_fd_ >= 0) {
+      close(interrupt_fd_);
+      interrupt_fd_ = -1;
+    }
+#endif  // PYZEUGKISTE_HAS_INOTIFY
+  }
+
+#ifdef PYZEUGKISTE_HAS_INOTIFY
+  void ReadEvents(std::set<std::string> &changed) {
+    alignas(inotify_event) char buffer[4096];
+    while (true) {
+      const ssize_t len = read(inotify_fd_, buffer, sizeof(buffer));
+      if (len <= 0) {
+        break;
+      }
+
+      for (const char *ptr = buffer; ptr < buffer + len;) {
+        const auto *event = reinterpret_cast<const inotify_event *>(ptr);
+        ptr += sizeof(inotify_event) + event->len;
+
+        if ((event->mask & IN_Q_OVERFLOW) != 0) {
+          // Events have been dropped, thus we must assume that all files
+          // have changed.
+          changed.insert(files_.begin(), files_.end());
+          continue;
+        }
+
+        const auto dir = directories_.find(event->wd);
+        if ((event->len == 0) || (dir == directories_.end())) {
+          continue;
+        }
+        std::string fname =
+            (std::filesystem::path{dir->second} / event->name).string();
+        if (files_.count(fname) > 0) {
+          changed.insert(std::move(fname));
+        }
+      }
+    }
+  }
+#endif  // PYZEUGKISTE_HAS_INOTIFY
+};
+
+/// @brief Monitors a configuration file and its nested configuration files
+///   and reloads the configuration whenever one of them has been modified.
+///
+/// Modifications are handled on a background thread. After a burst of file
+/// system events has settled (see `debounce`), only the modified files are
+/// parsed again. The reloaded configuration is then assembled from the
+/// (cached) parsing results of all files, *i.e.* the nested configurations
+/// are inserted at their original parameters.
+///
+/// The callbacks are invoked from the background thread. A callback may also
+/// destroy the watcher. In this case, the background thread is detached and
+/// keeps its (shared) state alive until it finishes.
+class ConfigWatcher {
+ public:
+  using ReloadCallback = std::function<void(
+      werkzeugkiste::config::Configuration &&, ParameterDiff &&)>;
+  using ErrorCallback = std::function<void(std::exception_ptr)>;
+
+  ConfigWatcher(ConfigSource source,
+      std::vector<NestedSource> nested,
+      std::chrono::milliseconds debounce,
+      ReloadCallback on_reload,
+      ErrorCallback on_error)
+      : state_{std::make_shared<State>(std::move(source),
+            std::move(nested),
+            debounce,
+            std::move(on_reload),
+            std::move(on_error))} {
+    worker_ = std::thread{[state = state_]() { state->Run(); }};
+  }
+
+  virtual ~ConfigWatcher() {
+    if (std::this_thread::get_id() == worker_.get_id()) {
+      // Destroyed from within a callback. The worker will finish after the
+      // callback returns, but we must not wait for it.
+      state_->stop = true;
+      worker_.detach();
+    } else {
+      Stop();
+    }
+  }
+
+  ConfigWatcher(const ConfigWatcher &) = delete;
+  ConfigWatcher &operator=(const ConfigWatcher &) = delete;
+  ConfigWatcher(ConfigWatcher &&) = delete;
+  ConfigWatcher &operator=(ConfigWatcher &&) = delete;
+
+  /// @brief Stops monitoring and waits for the background thread to finish.
+  ///   If called from within a callback, the background thread will finish
+  ///   after the callback returns.
+  void Stop() {
+    state_->stop = true;
+    if (std::this_thread::get_id() == worker_.get_id()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock{stop_mutex_};
+    state_->monitor.Interrupt();
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+  }
+
+  /// @brief Returns true if the configuration files are still monitored.
+  bool IsRunning() const { return state_->running; }
+
+  /// @brief Returns the monitored files, *i.e.* the configuration file and
+  ///   all nested configuration files.
+  std::vector<std::string> Files() const { return state_->Files(); }
+
+ private:
+  /// @brief Everything the background thread works on. It is shared with the
+  ///   thread, so that it outlives a watcher which has been destroyed by one
+  ///   of its callbacks.
+  struct State {
+    State(ConfigSource src,
+        std::vector<NestedSource> nested_src,
+        std::chrono::milliseconds debounce_interval,
+        ReloadCallback reload_callback,
+        ErrorCallback error_callback)
+        : source{std::move(src)},
+          nested{std::move(nested_src)},
+          debounce{debounce_interval},
+          on_reload{std::move(reload_callback)},
+          on_error{std::move(error_callback)},
+          monitor{Files()} {}
+
+    const ConfigSource source;
+    const std::vector<NestedSource> nested;
+    const std::chrono::milliseconds debounce;
+    const ReloadCallback on_reload;
+    const ErrorCallback on_error;
+
+    FileMonitor monitor;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> running{true};
+
+    // Only accessed by the background thread:
+
+    /// @brief Parsing result of the configuration file.
+    std::optional<werkzeugkiste::config::Configuration> root{};
+
+    /// @brief Parsing results of the nested configuration files.
+    std::map<std::string, werkzeugkiste::config::Configuration> nested_cache{};
+
+    /// @brief The most recently assembled configuration.
+    std::optional<werkzeugkiste::config::Configuration> current{};
+
+    std::vector<std::string> Files() const {
+      std::vector<std::string> files{source.filename};
+      for (const NestedSource &ref : nested) {
+        if (std::find(files.begin(), files.end(), ref.filename) ==
+            files.end()) {
+          files.push_back(ref.filename);
+        }
+      }
+      return files;
+    }
+
+    void Run() {
+      try {
+        // Parse all files once to populate the caches.
+        Update({}, /*notify=*/false);
+
+        while (!stop) {
+          std::set<std::string> changed = monitor.Wait(std::nullopt);
+          // Editors often write a file in several steps, thus we wait until
+          // no further modifications occur within the debounce interval.
+          while (!stop && !changed.empty()) {
+            std::set<std::string> more = monitor.Wait(debounce);
+            if (more.empty()) {
+              break;
+            }
+            changed.merge(more);
+          }
+
+          if (!stop && !changed.empty()) {
+            Update(changed, /*notify=*/true);
+          }
+        }
+      } catch (...) {
+        on_error(std::current_exception());
+      }
+      running = false;
+    }
+
+    /// @brief Parses the modified (or not yet cached) files and assembles
+    ///   the configuration. If `notify` is set, the reload callback will be
+    ///   invoked, unless the configuration did not change.
+    void Update(const std::set<std::string> &changed, bool notify) {
+      try {
+        // Parse into temporaries first, so that the caches remain valid if a
+        // file cannot be parsed.
+        std::optional<werkzeugkiste::config::Configuration> parsed_root{};
+        if (!root.has_value() || (changed.count(source.filename) > 0)) {
+          parsed_root = source.load(source.filename);
+        }
+
+        std::map<std::string, werkzeugkiste::config::Configuration> parsed{};
+        for (const NestedSource &ref : nested) {
+          if ((parsed.count(ref.filename) == 0) &&
+              ((nested_cache.count(ref.filename) == 0) ||
+                  (changed.count(ref.filename) > 0))) {
+            // Same loader as `LoadAllNested`, i.e. nested YAML and
+            // compressed files are supported, too.
+            parsed.emplace(
+                ref.filename, LoadConfigFileByExtension(ref.filename));
+          }
+        }
+
+        if (parsed_root.has_value()) {
+          root = std::move(parsed_root);
+        }
+        for (auto &entry : parsed) {
+          nested_cache.insert_or_assign(entry.first, std::move(entry.second));
+        }
+
+        werkzeugkiste::config::Configuration assembled = Assemble();
+        if (!notify) {
+          current = std::move(assembled);
+          return;
+        }
+
+        ParameterDiff diff =
+            current.has_value()
+                ? ComputeParameterDiff(current.value(), assembled)
+                : ComputeParameterDiff(
+                      werkzeugkiste::config::Configuration{}, assembled);
+        current = assembled;
+        if (!diff.Empty()) {
+          on_reload(std::move(assembled), std::move(diff));
+        }
+      } catch (...) {
+        on_error(std::current_exception());
+      }
+    }
+
+    /// @brief Inserts the cached nested configurations into a copy of the
+    ///   cached root configuration.
+    werkzeugkiste::config::Configuration Assemble() const {
+      werkzeugkiste::config::Configuration cfg = root.value();
+      // List elements cannot be replaced by a group, thus the affected list
+      // is rebuilt once per run of consecutive elements. The nested
+      // configurations must be inserted in their original order, as they
+      // could also have been loaded into a previously inserted one.
+      std::string list_key{};
+      ListElementReplacements elements{};
+      auto flush = [&cfg, &list_key, &elements]() {
+        if (!elements.empty()) {
+          ReplaceListElements(cfg, list_key, elements);
+          elements.clear();
+        }
+      };
+
+      for (const NestedSource &ref : nested) {
+        const werkzeugkiste::config::Configuration &group =
+            nested_cache.at(ref.filename);
+        if (!ref.key.empty() && (ref.key.back() == ']')) {
+          const std::size_t pos = ref.key.rfind('[');
+          if (ref.key.compare(0, pos, list_key) != 0) {
+            flush();
+            list_key = ref.key.substr(0, pos);
+          }
+          elements.insert_or_assign(
+              std::stoul(ref.key.substr(pos + 1)), &group);
+        } else {
+          flush();
+          if (cfg.Contains(ref.key)) {
+            cfg.Delete(ref.key);
+          }
+          cfg.SetGroup(ref.key, group);
+        }
+      }
+      flush();
+      return cfg;
+    }
+  };
+
+  std::shared_ptr<State> state_;
+  std::thread worker_{};
+  std::mutex stop_mutex_{};
+};
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_WATCH_H
@@ -0,0 +1,497 @@
+#ifndef WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_YAML_H
+#define WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_YAML_H
+
+#include <werkzeugkiste/config/configuration.h>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <locale>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#ifdef pyzeugkiste_WITH_YAML
+#include <yaml-cpp/yaml.h>
+#endif
+
+namespace werkzeugkiste::bindings::detail {
+/// @brief Resolution of plain (*i.e.* unquoted and untagged) YAML scalars,
+///   following the YAML 1.2 core schema plus the timestamp types supported
+///   by werkzeugkiste.
+namespace yaml {
+inline bool IsDigit(char c) { return (c >= '0') && (c <= '9'); }
+
+inline bool AllOf(std::string_view str, bool (*pred)(char)) {
+  if (str.empty()) {
+    return false;
+  }
+  for (char c : str) {
+    if (!pred(c)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline bool IsBool(std::string_view str, bool &value) {
+  if ((str == "true") || (str == "True") || (str == "TRUE")) {
+    value = true;
+    return true;
+  }
+  if ((str == "false") || (str == "False") || (str == "FALSE")) {
+    value = false;
+    return true;
+  }
+  return false;
+}
+
+/// @brief Returns true if `str` is a decimal, octal (`0o`) or hexadecimal
+///   (`0x`) integer. Throws a `ParseError` if the value cannot be
+///   represented by an `int64_t`.
+inline bool IsInteger(std::string_view str, int64_t &value) {
+  int base = 10;
+  bool negative = false;
+  std::string_view digits{str};
+  if ((str.length() > 2) && (str[0] == '0') && (str[1] == 'o')) {
+    base = 8;
+    digits.remove_prefix(2);
+    if (!AllOf(digits, [](char c) { return (c >= '0') && (c <= '7'); })) {
+      return false;
+    }
+  } else if ((str.length() > 2) && (str[0] == '0') && (str[1] == 'x')) {
+    base = 16;
+    digits.remove_prefix(2);
+    if (!AllOf(digits, [](char c) {
+          return IsDigit(c) || ((c >= 'a') && (c <= 'f')) ||
+                 ((c >= 'A') && (c <= 'F'));
+        })) {
+      return false;
+    }
+  } else {
+    if (!digits.empty() && ((digits[0] == '-') || (digits[0] == '+'))) {
+      negative = (digits[0] == '-');
+      digits.remove_prefix(1);
+    }
+    if (!AllOf(digits, IsDigit)) {
+      return false;
+    }
+  }
+
+  // Parse the magnitude as unsigned, such that the minimum int64 value can
+  // also be represented.
+  uint64_t magnitude{0};
+  const auto result = std::from_chars(
+      digits.data(), digits.data() + digits.length(), magnitude, base);
+  constexpr uint64_t kMaxPositive =
+      static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+  if ((result.ec == std::errc::result_out_of_range) ||
+      (magnitude > kMaxPositive + (negative ? 1U : 0U))) {
+    std::string msg{"Integer value `"};
+    msg += str;
+    msg += "` is out of range!";
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+  value = negative ? static_cast<int64_t>(0U - magnitude)
+                   : static_cast<int64_t>(magnitude);
+  return true;
+}
+
+inline bool IsFloatingPoint(std::string_view str, double &value) {
+  std::string_view number{str};
+  bool negative = false;
+  if (!number.empty() && ((number[0] == '-') || (number[0] == '+'))) {
+    negative = (number[0] == '-');
+    number.remove_prefix(1);
+  }
+
+  if ((number == ".inf") || (number == ".Inf") || (number == ".INF")) {
+    value = negative ? -std::numeric_limits<double>::infinity()
+                     : std::numeric_limits<double>::infinity();
+    return true;
+  }
+  if ((str == ".nan") || (str == ".NaN") || (str == ".NAN")) {
+    value = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+
+  // [0-9]* ( \. [0-9]* )? ( [eE] [-+]? [0-9]+ )?, with at least one digit
+  // in the mantissa. Integers are resolved before floating point numbers.
+  std::size_t pos = 0;
+  std::size_t num_mantissa_digits = 0;
+  while ((pos < number.length()) && IsDigit(number[pos])) {
+    ++pos;
+    ++num_mantissa_digits;
+  }
+  if ((pos < number.length()) && (number[pos] == '.')) {
+    ++pos;
+    while ((pos < number.length()) && IsDigit(number[pos])) {
+      ++pos;
+      ++num_mantissa_digits;
+    }
+  }
+  if (num_mantissa_digits == 0) {
+    return false;
+  }
+  if ((pos < number.length()) && ((number[pos] == 'e') || (number[pos] == 'E'))) {
+    ++pos;
+    if ((pos < number.length()) &&
+        ((number[pos] == '-') || (number[pos] == '+'))) {
+      ++pos;
+    }
+    if (!AllOf(number.substr(pos), IsDigit)) {
+      return false;
+    }
+    pos = number.length();
+  }
+  if (pos != number.length()) {
+    return false;
+  }
+
+  // std::from_chars for floating point numbers is not yet available on all
+  // supported platforms, thus we rely on a locale-independent stream.
+  std::istringstream stream{std::string{str}};
+  stream.imbue(std::locale::classic());
+  stream >> value;
+  return !stream.fail();
+}
+
+inline bool HasDateShape(std::string_view str) {
+  return (str.length() == 10) && IsDigit(str[0]) && IsDigit(str[1]) &&
+         IsDigit(str[2]) && IsDigit(str[3]) && (str[4] == '-') &&
+         IsDigit(str[5]) && IsDigit(str[6]) && (str[7] == '-') &&
+         IsDigit(str[8]) && IsDigit(str[9]);
+}
+
+/// @brief Returns the length of the `HH:MM[:SS[.fraction]]` prefix of
+///   `str`, or 0 if it does not start with a time.
+inline std::size_t TimeShapeLength(std::string_view str) {
+  if ((str.length() < 5) || !IsDigit(str[0]) || !IsDigit(str[1]) ||
+      (str[2] != ':') || !IsDigit(str[3]) || !IsDigit(str[4])) {
+    return 0;
+  }
+  std::size_t pos = 5;
+  if ((str.length() >= 8) && (str[5] == ':') && IsDigit(str[6]) &&
+      IsDigit(str[7])) {
+    pos = 8;
+    if ((pos + 1 < str.length()) && (str[pos] == '.') &&
+        IsDigit(str[pos + 1])) {
+      ++pos;
+      while ((pos < str.length()) && IsDigit(str[pos])) {
+        ++pos;
+      }
+    }
+  }
+  return pos;
+}
+
+inline bool HasTimeShape(std::string_view str) {
+  const std::size_t len = TimeShapeLength(str);
+  return (len > 0) && (len == str.length());
+}
+
+inline bool HasDateTimeShape(std::string_view str) {
+  if ((str.length() < 16) || !HasDateShape(str.substr(0, 10)) ||
+      ((str[10] != 'T') && (str[10] != 't') && (str[10] != ' '))) {
+    return false;
+  }
+  const std::string_view remainder = str.substr(11);
+  const std::size_t time_len = TimeShapeLength(remainder);
+  if (time_len == 0) {
+    return false;
+  }
+  const std::string_view offset = remainder.substr(time_len);
+  return offset.empty() || (offset == "Z") || (offset == "z") ||
+         ((offset.length() == 6) && ((offset[0] == '+') || (offset[0] == '-')) &&
+             IsDigit(offset[1]) && IsDigit(offset[2]) && (offset[3] == ':') &&
+             IsDigit(offset[4]) && IsDigit(offset[5]));
+}
+
+/// @brief Parses a date/time string via werkzeugkiste, returns `nullopt` if
+///   it is invalid.
+template <typename Tp>
+std::optional<Tp> TryParse(std::string_view str) {
+  try {
+    return Tp{std::string{str}};
+  } catch (const werkzeugkiste::config::ParseError &) {
+    return std::nullopt;
+  }
+}
+
+/// @brief Resolves the type of a plain scalar and invokes `visit` with the
+///   corresponding value, *i.e.* a `bool`, `int64_t`, `double`, `date`,
+///   `time`, `date_time` or `std::string_view`.
+template <typename Visitor>
+void VisitPlainScalar(std::string_view str, Visitor &&visit) {
+  bool flag{};
+  if (IsBool(str, flag)) {
+    visit(flag);
+    return;
+  }
+
+  int64_t integer{};
+  if (IsInteger(str, integer)) {
+    visit(integer);
+    return;
+  }
+
+  double dbl{};
+  if (IsFloatingPoint(str, dbl)) {
+    visit(dbl);
+    return;
+  }
+
+  // Strings which look like dates/times, but are invalid (e.g. a month
+  // number of 13), remain strings.
+  if (HasDateShape(str)) {
+    if (auto d = TryParse<werkzeugkiste::config::date>(str)) {
+      visit(*d);
+      return;
+    }
+  } else if (HasTimeShape(str)) {
+    if (auto t = TryParse<werkzeugkiste::config::time>(str)) {
+      visit(*t);
+      return;
+    }
+  } else if (HasDateTimeShape(str)) {
+    if (auto dt = TryParse<werkzeugkiste::config::date_time>(str)) {
+      visit(*dt);
+      return;
+    }
+  }
+
+  visit(str);
+}
+
+/// @brief Read-only stream buffer over existing memory, which allows
+///   parsing a string_view without copying it.
+class MemoryStreamBuffer : public std::streambuf {
+ public:
+  explicit MemoryStreamBuffer(std::string_view str) {
+    // The get area is never written to, thus the const_cast is safe.
+    char *begin = const_cast<char *>(str.data());
+    setg(begin, begin, begin + str.length());
+  }
+};
+
+#ifdef pyzeugkiste_WITH_YAML
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    bool value) {
+  cfg.SetBool(key, value);
+}
+
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    int64_t value) {
+  cfg.SetInt64(key, value);
+}
+
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    double value) {
+  cfg.SetDouble(key, value);
+}
+
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    std::string_view value) {
+  cfg.SetString(key, value);
+}
+
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    const werkzeugkiste::config::date &value) {
+  cfg.SetDate(key, value);
+}
+
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    const werkzeugkiste::config::time &value) {
+  cfg.SetTime(key, value);
+}
+
+inline void SetValue(werkzeugkiste::config::Configuration &cfg,
+    std::string_view key,
+    const werkzeugkiste::config::date_time &value) {
+  cfg.SetDateTime(key, value);
+}
+
+[[noreturn]] inline void ThrowNodeError(const YAML::Node &node,
+    std::string_view reason) {
+  std::string msg{reason};
+  const YAML::Mark mark = node.Mark();
+  if (!mark.is_null()) {
+    msg += " (line ";
+    msg += std::to_string(mark.line + 1);
+    msg += ", column ";
+    msg += std::to_string(mark.column + 1);
+    msg += ')';
+  }
+  msg += '!';
+  throw werkzeugkiste::config::ParseError{msg};
+}
+
+/// @brief Invokes `visit` with the value of the given scalar node. Quoted,
+///   block and `!!str`-tagged scalars are always strings.
+template <typename Visitor>
+void VisitScalar(const YAML::Node &node, Visitor &&visit) {
+  const std::string &tag = node.Tag();
+  const std::string &str = node.Scalar();
+  if ((tag == "!") || (tag == "tag:yaml.org,2002:str")) {
+    visit(std::string_view{str});
+  } else {
+    VisitPlainScalar(str, std::forward<Visitor>(visit));
+  }
+}
+
+class ConfigurationBuilder {
+ public:
+  explicit ConfigurationBuilder(werkzeugkiste::config::NullValuePolicy policy)
+      : none_policy_{policy} {}
+
+  werkzeugkiste::config::Configuration BuildGroup(const YAML::Node &map) const {
+    werkzeugkiste::config::Configuration cfg{};
+    for (const auto &item : map) {
+      if (!item.first.IsScalar()) {
+        ThrowNodeError(item.first, "YAML mapping keys must be scalars");
+      }
+      const std::string &key = item.first.Scalar();
+      if (!werkzeugkiste::config::IsValidKey(key, /*allow_dots=*/false)) {
+        std::string msg{"YAML mapping key `"};
+        msg += key;
+        msg +=
+            "` is not a valid parameter name. Only alpha-numeric characters, "
+            "hyphen and underscore are allowed";
+        ThrowNodeError(item.first, msg);
+      }
+
+      const YAML::Node &value = item.second;
+      switch (value.Type()) {
+        case YAML::NodeType::Scalar:
+          VisitScalar(
+              value, [&cfg, &key](auto &&v) { SetValue(cfg, key, v); });
+          break;
+
+        case YAML::NodeType::Sequence:
+          cfg.CreateList(key);
+          AppendSequence(cfg, key, value);
+          break;
+
+        case YAML::NodeType::Map:
+          cfg.SetGroup(key, BuildGroup(value));
+          break;
+
+        default:  // Null or undefined
+          if (none_policy_ == werkzeugkiste::config::NullValuePolicy::NullString) {
+            cfg.SetString(key, "null");
+          } else if (none_policy_ ==
+                     werkzeugkiste::config::NullValuePolicy::EmptyList) {
+            cfg.CreateList(key);
+          } else if (none_policy_ ==
+                     werkzeugkiste::config::NullValuePolicy::Fail) {
+            ThrowNullError(value, key);
+          }
+          break;
+      }
+    }
+    return cfg;
+  }
+
+ private:
+  werkzeugkiste::config::NullValuePolicy none_policy_;
+
+  /// @brief Appends all elements of the sequence to the (existing) list `key`.
+  void AppendSequence(werkzeugkiste::config::Configuration &cfg,
+      const std::string &key,
+      const YAML::Node &seq) const {
+    for (const auto &value : seq) {
+      switch (value.Type()) {
+        case YAML::NodeType::Scalar:
+          VisitScalar(value, [&cfg, &key](auto &&v) { cfg.Append(key, v); });
+          break;
+
+        case YAML::NodeType::Sequence: {
+          const std::string elem_key =
+              werkzeugkiste::config::Configuration::KeyForListElement(
+                  key, cfg.Size(key));
+          cfg.AppendList(key);
+          AppendSequence(cfg, elem_key, value);
+          break;
+        }
+
+        case YAML::NodeType::Map:
+          cfg.Append(key, BuildGroup(value));
+          break;
+
+        default:  // Null or undefined
+          if (none_policy_ == werkzeugkiste::config::NullValuePolicy::NullString) {
+            cfg.Append(key, std::string_view{"null"});
+          } else if (none_policy_ ==
+                     werkzeugkiste::config::NullValuePolicy::EmptyList) {
+            cfg.AppendList(key);
+          } else if (none_policy_ ==
+                     werkzeugkiste::config::NullValuePolicy::Fail) {
+            ThrowNullError(value, key);
+          }
+          break;
+      }
+    }
+  }
+
+  [[noreturn]] static void ThrowNullError(const YAML::Node &node,
+      std::string_view key) {
+    std::string msg{"Null values are not supported, but parameter `"};
+    msg += key;
+    msg += "` is null";
+    ThrowNodeError(node, msg);
+  }
+};
+#endif  // pyzeugkiste_WITH_YAML
+}  // namespace yaml
+
+/// @brief Loads a configuration from a YAML string.
+///
+/// The document is parsed by yaml-cpp and converted into the configuration
+/// tree directly, *i.e.* without any intermediate python objects. The
+/// top-level node must be a mapping (or empty).
+inline werkzeugkiste::config::Configuration LoadYAMLString(
+    std::string_view yaml_str,
+    werkzeugkiste::config::NullValuePolicy none_policy) {
+#ifdef pyzeugkiste_WITH_YAML
+  YAML::Node root{};
+  try {
+    yaml::MemoryStreamBuffer buffer{yaml_str};
+    std::istream stream{&buffer};
+    root = YAML::Load(stream);
+  } catch (const YAML::Exception &e) {
+    std::string msg{"Invalid YAML: "};
+    msg += e.what();
+    throw werkzeugkiste::config::ParseError{msg};
+  }
+
+  if (root.IsNull() || !root.IsDefined()) {
+    return werkzeugkiste::config::Configuration{};
+  }
+  if (!root.IsMap()) {
+    yaml::ThrowNodeError(root, "The top-level YAML node must be a mapping");
+  }
+  return yaml::ConfigurationBuilder{none_policy}.BuildGroup(root);
+#else   // pyzeugkiste_WITH_YAML
+  (void)yaml_str;
+  (void)none_policy;
+  throw std::runtime_error{
+      "Loading YAML configurations requires yaml-cpp, which was not "
+      "available when pyzeugkiste was built!"};
+#endif  // pyzeugkiste_WITH_YAML
+}
+}  // namespace werkzeugkiste::bindings::detail
+
+#endif  // WERKZEUGKISTE_BINDINGS_CONFIG_DETAIL_YAML_H
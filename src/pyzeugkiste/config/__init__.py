@@ -1,15 +1,21 @@
 from pyzeugkiste._core._cfg import (
     __doc__, Config, ConfigType, NullValuePolicy,
-    load, load_toml_str, load_toml_file,
-    load_json_str, load_json_file,
-    load_libconfig_str, load_libconfig_file,
+    load, load_many, load_toml_str, load_toml_file,
+    set_cache_limit, clear_cache, cache_info,
+    load_json_str, load_json_file, iter_json_lines, JSONLinesIterator,
+    load_libconfig_str, load_libconfig_file, load_yaml_str, load_yaml_file,
+    load_binary, ConfigWatcher,
     KeyError, TypeError, ValueError, ParseError
 )
+from pyzeugkiste.config._async import load_async, load_many_async
+from pyzeugkiste.config._shared import to_shared_memory, load_shared_memory
 
 __module__ = "pyzeugkiste.config"
 Config.__module__ = __module__
 ConfigType.__module__ = __module__
 NullValuePolicy.__module__ = __module__
+JSONLinesIterator.__module__ = __module__
+ConfigWatcher.__module__ = __module__
 KeyError.__module__ = __module__
 TypeError.__module__ = __module__
 ValueError.__module__ = __module__
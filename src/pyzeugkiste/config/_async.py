@@ -0,0 +1,74 @@
+"""Awaitable variants of the configuration loading functions."""
+import asyncio
+import functools
+from concurrent.futures import Executor
+from typing import Iterable, List, Optional
+
+from pyzeugkiste._core._cfg import Config, load, load_many
+
+
+async def load_async(
+        filename, cached: bool = False,
+        executor: Optional[Executor] = None) -> Config:
+    """
+    Awaitable variant of :meth:`load`.
+
+    The configuration is parsed by the native library on a worker thread,
+    which does not hold the GIL while parsing. Thus, the event loop stays
+    responsive while (large) configuration files are loaded.
+
+    Args:
+      filename: Path to the configuration file, see :meth:`load`.
+      cached: If ``True``, use the process-wide cache, see :meth:`load`.
+      executor: The :class:`concurrent.futures.Executor` to run the loading
+        task. If ``None``, the default executor of the running event loop
+        will be used.
+
+    Raises:
+      :class:`~pyzeugkiste.config.ParseError`: If a parsing error occured.
+
+    .. code-block:: python
+       :caption: Example
+
+       import asyncio
+       from pyzeugkiste import config as pyc
+
+       async def main():
+           cfg = await pyc.load_async('config.toml')
+           cfgs = await pyc.load_many_async(['a.toml', 'b.json'])
+
+       asyncio.run(main())
+    """
+    loop = asyncio.get_running_loop()
+    return await loop.run_in_executor(
+        executor, functools.partial(load, filename, cached=cached))
+
+
+async def load_many_async(
+        filenames: Iterable, num_threads: int = 0,
+        executor: Optional[Executor] = None) -> List[Config]:
+    """
+    Awaitable variant of :meth:`load_many`.
+
+    The files are parsed concurrently by the native thread pool of
+    :meth:`load_many`, which does not hold the GIL. Thus, the event loop
+    stays responsive while the configurations are loaded.
+
+    Args:
+      filenames: Iterable of configuration file paths, see :meth:`load_many`.
+      num_threads: Number of parsing threads, see :meth:`load_many`.
+      executor: The :class:`concurrent.futures.Executor` to run the loading
+        task. If ``None``, the default executor of the running event loop
+        will be used.
+
+    Raises:
+      :class:`~pyzeugkiste.config.ParseError`: If any file could not be
+        loaded, see :meth:`load_many`.
+    """
+    # Consume the iterable on the event loop's thread, as it may not be
+    # thread-safe (e.g. a generator).
+    filenames = list(filenames)
+    loop = asyncio.get_running_loop()
+    return await loop.run_in_executor(
+        executor,
+        functools.partial(load_many, filenames, num_threads=num_threads))
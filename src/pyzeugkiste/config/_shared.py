@@ -0,0 +1,102 @@
+"""Sharing configurations between processes via shared memory."""
+import os
+from typing import Optional
+
+from pyzeugkiste._core._cfg import Config, load_binary
+
+
+def to_shared_memory(cfg: Config, name: Optional[str] = None):
+    """
+    Publishes the binary encoding of the configuration in a shared memory
+    block.
+
+    The block serves as a transport of the encoded snapshot, see
+    :meth:`Config.to_binary`: it is written once and can be read by any
+    number of processes via :meth:`load_shared_memory`, which avoids
+    pickling the configuration for each of them. The configuration itself is
+    *not* shared. Each attaching process decodes its own, full copy of the
+    parameter tree, *i.e.* the memory requirements grow with the number of
+    processes (plus the size of the block) and attaching takes time
+    proportional to the size of the configuration.
+
+    Requires python 3.8 or later.
+
+    Args:
+      cfg: The :class:`~pyzeugkiste.config.Config` to publish.
+      name: Unique name of the shared memory block. If ``None``, a random
+        name will be chosen.
+
+    Returns:
+      The :class:`multiprocessing.shared_memory.SharedMemory` block. Its
+      ``name`` must be passed to the attaching processes. The caller owns the
+      block, *i.e.* must ``close()`` and ``unlink()`` it once it is no longer
+      needed.
+
+    .. code-block:: python
+       :caption: Example
+
+       from concurrent.futures import ProcessPoolExecutor
+       from pyzeugkiste import config as pyc
+
+       def work(shm_name):
+           cfg = pyc.load_shared_memory(shm_name)
+           return cfg['value']
+
+       shm = pyc.to_shared_memory(pyc.load('config.toml'))
+       try:
+           with ProcessPoolExecutor(max_workers=32) as pool:
+               results = list(pool.map(work, [shm.name] * 32))
+       finally:
+           shm.close()
+           shm.unlink()
+    """
+    from multiprocessing import shared_memory
+
+    encoded = cfg.to_binary()
+    shm = shared_memory.SharedMemory(
+        name=name, create=True, size=len(encoded))
+    shm.buf[:len(encoded)] = encoded
+    return shm
+
+
+def load_shared_memory(name: str) -> Config:
+    """
+    Loads a configuration which has been published via
+    :meth:`to_shared_memory`.
+
+    The binary encoding is decoded directly from the shared memory block,
+    *i.e.* without copying the encoded data into the process first. Decoding
+    builds a full, private parameter tree, which takes time proportional to
+    the size of the configuration. The returned
+    :class:`~pyzeugkiste.config.Config` is thus independent of the shared
+    memory block and supports all getters, *e.g.* :meth:`Config.int` or
+    :meth:`Config.numpy`, as usual. The shared memory block itself is
+    not modified.
+
+    Requires python 3.8 or later.
+
+    Args:
+      name: Name of the shared memory block.
+
+    Raises:
+      :class:`FileNotFoundError`: If there is no such shared memory block.
+      :class:`~pyzeugkiste.config.ParseError`: If the block does not hold a
+        valid binary configuration.
+    """
+    from multiprocessing import shared_memory
+
+    try:
+        # Attaching processes must not register the block with the resource
+        # tracker, which would otherwise unlink it upon their exit.
+        shm = shared_memory.SharedMemory(name=name, track=False)
+    except TypeError:  # pragma: no cover
+        # Python < 3.13 does not support the `track` parameter, but always
+        # registers the block (on POSIX systems).
+        shm = shared_memory.SharedMemory(name=name)
+        if os.name == 'posix':
+            from multiprocessing import resource_tracker
+            resource_tracker.unregister(shm._name, 'shared_memory')
+    try:
+        return load_binary(shm.buf)
+    finally:
+        shm.close()
@@ -0,0 +1,36 @@
+import time
+import pytest
+
+
+def pytest_addoption(parser):
+    parser.addoption(
+        '--run-benchmarks', action='store_true', default=False,
+        help='Run the timing benchmarks (which are skipped by default).')
+
+
+def pytest_configure(config):
+    config.addinivalue_line(
+        'markers',
+        'benchmark: timing benchmark, only runs with --run-benchmarks')
+
+
+def pytest_collection_modifyitems(config, items):
+    if config.getoption('--run-benchmarks'):
+        return
+    skip = pytest.mark.skip(reason='requires --run-benchmarks')
+    for item in items:
+        if 'benchmark' in item.keywords:
+            item.add_marker(skip)
+
+
+@pytest.fixture
+def elapsed():
+    # Returns the fastest of multiple runs to reduce timing noise.
+    def measure(func, repeat=3):
+        timings = []
+        for _ in range(repeat):
+            start = time.perf_counter()
+            func()
+            timings.append(time.perf_counter() - start)
+        return min(timings)
+    return measure
@@ -241,6 +241,18 @@ def test_group():
     cfg['lvl1']['lvl2']['flt'] = 4
     assert cfg['lvl1.lvl2.flt'] == pytest.approx(4)
 
+    # Views are instances of the registered type and keep the shared data
+    # alive, even if the viewed configuration is no longer referenced.
+    numbers = cfg['numbers']
+    lvl2 = cfg['lvl1']['lvl2']
+    assert type(numbers) is pyc.Config
+    assert type(lvl2) is pyc.Config
+    numbers[0] = 10
+    assert cfg['numbers[0]'] == 10
+    del cfg
+    assert numbers.list() == [10, 2, 3]
+    assert lvl2['flt'] == pytest.approx(4)
+
 
 def test_dict_set():
     cfg_toml = pyc.load_toml_str("""
@@ -329,6 +341,38 @@ def test_dict_set():
         cfg['mixed-lst'] = lst
 
 
+def test_set_python_types():
+    class MyStr(str):
+        pass
+
+    class MyDict(dict):
+        pass
+
+    cfg = pyc.Config()
+    cfg['grp'] = MyDict(
+        s=MyStr('value'), f=np.float64(1.5), nested=[(1, 2), [3]],
+        dt=datetime.datetime(2023, 4, 1, 8, 30), d=datetime.date(2023, 4, 1),
+        t=datetime.time(8, 30))
+    assert cfg['grp.s'] == 'value'
+    assert cfg['grp.f'] == pytest.approx(1.5)
+    assert cfg['grp.nested'].list() == [[1, 2], [3]]
+    assert cfg['grp.dt'] == datetime.datetime(2023, 4, 1, 8, 30)
+    assert cfg['grp.d'] == datetime.date(2023, 4, 1)
+    assert cfg['grp.t'] == datetime.time(8, 30)
+
+    cfg['grp.nested'].append(MyStr('appended'))
+    assert cfg['grp.nested[2]'] == 'appended'
+
+    with pytest.raises(pyc.TypeError):
+        cfg['obj'] = object()
+    with pytest.raises(pyc.TypeError):
+        cfg['grp.nested'].append(object())
+    with pytest.raises(pyc.TypeError):
+        cfg['lst'] = [1, object()]
+    with pytest.raises(pyc.TypeError):
+        cfg['dct'] = {'obj': object()}
+
+
 def test_dict_get():
     cfg = pyc.load_toml_str("""
         [scalars]
@@ -820,6 +864,178 @@ def test_equality():
     assert c1['table1']['nested'] == c2['group2']['nested-list']
     assert c2['group1']['nested'] == c2['group2']['nested-list']
 
+    # Dictionaries are compared element-wise
+    d = {
+        'int': 42,
+        'dt': {'date': datetime.date(2023, 4, 1),
+               'time': datetime.time(8, 0, 30)},
+        'lst': [1, 2, 3.4],
+        'nested': [[1, 2], (3,), 4, {'foo': 'bar', 'lst': [0.5, 1]}]
+    }
+    assert c1['table1'] == d
+    assert c2['group1'] == d
+    assert c1 != d
+    d['nested'][3]['foo'] = 'baz'
+    assert c1['table1'] != d
+    d['nested'][3]['foo'] = 'bar'
+    d['lst'][2] = 3
+    assert c1['table1'] != d
+    d['lst'][2] = 3.4
+    d['dt'] = c1['table1.dt']
+    assert c1['table1'] == d
+    assert c1['table1'] != {'int': 42}
+    assert c1['table2'] != {'str': 'value', 'other': 'value'}
+    assert c1['table2'] != {'str.other': 'value'}
+    assert c1['table2'] == {'str': 'value'}
+
+
+def test_diff():
+    prev = pyc.load_toml_str("""
+        name = 'cam'
+        fps = 30
+        lst = [1, 2]
+
+        [roi]
+        width = 640
+        offset = { x = 1, y = 2 }
+        """)
+    curr = pyc.load_toml_str("""
+        fps = 'auto'
+        lst = [1, 2, 3]
+
+        [roi]
+        width = 640
+        height = 480
+        offset = { x = 1, y = 3 }
+
+        [sensor]
+        gain = 1.5
+        """)
+
+    diff = prev.diff(curr)
+    assert diff['added'] == {'roi.height': 480, 'sensor': {'gain': 1.5}}
+    assert diff['removed'] == {'name': 'cam'}
+    assert diff['changed'] == {
+        'fps': (30, 'auto'),
+        'lst': ([1, 2], [1, 2, 3]),
+        'roi.offset.y': (2, 3)}
+
+    empty = curr.diff(curr.copy())
+    assert not empty['added'] and not empty['removed']
+    assert not empty['changed']
+
+    # Views are compared relative to the viewed group
+    diff = prev['roi'].diff(curr['roi'])
+    assert diff['added'] == {'height': 480}
+    assert diff['changed'] == {'offset.y': (2, 3)}
+    with pytest.raises(pyc.TypeError):
+        prev['lst'].diff(curr['lst'])
+
+    prev.apply_patch(prev.diff(curr))
+    assert prev == curr
+
+    with pytest.raises(pyc.KeyError):
+        prev.apply_patch({'removed': {'no-such-key': 1}})
+    with pytest.raises(pyc.ValueError):
+        prev.apply_patch({'changed': {'fps': ('auto',)}})
+
+    # Views are patched relative to the viewed group
+    view = prev['roi']
+    view.apply_patch({'removed': {'height': 480}, 'added': {'depth': 3}})
+    assert prev['roi.depth'] == 3
+    assert 'roi.height' not in prev
+
+    # A failing patch leaves the configuration unchanged
+    snapshot = prev.copy()
+    with pytest.raises(pyc.KeyError):
+        prev.apply_patch({
+            'removed': {'fps': 'auto', 'lst': [1, 2, 3], 'no-such-key': 1}})
+    with pytest.raises(pyc.ValueError):
+        prev.apply_patch({
+            'removed': {'lst': [1, 2, 3]},
+            'changed': {'fps': ('auto', 25), 'roi.width': (640,)}})
+    with pytest.raises(pyc.TypeError):
+        prev.apply_patch({
+            'changed': {'fps': ('auto', 25)},
+            'added': {'new': 1, 'invalid': object()}})
+    assert prev == snapshot
+
+    # Only the viewed group is replaced, also if the patch fails
+    other = prev['sensor']
+    view.apply_patch({'changed': {'width': (640, 800)}})
+    assert prev['roi.width'] == 800
+    assert other['gain'] == pytest.approx(1.5)
+    snapshot = prev.copy()
+    with pytest.raises(pyc.KeyError):
+        view.apply_patch({'added': {'x': 1}, 'removed': {'no-such-key': 1}})
+    assert prev == snapshot
+    with pytest.raises(pyc.TypeError):
+        prev['lst'].apply_patch({'added': {'x': 1}})
+
+
+def test_fingerprint():
+    c1 = pyc.load_toml_str("""
+        int = 3
+        flt = 0.0
+
+        [group]
+        lst = [1, 2, { str = 'value' }]
+
+        [other]
+        str = 'value'
+        """)
+    c2 = c1.copy()
+    assert c1.fingerprint() == c2.fingerprint()
+    assert c1['group'].fingerprint() == c2['group'].fingerprint()
+    assert c1['group'].fingerprint() != c1['other'].fingerprint()
+
+    fp = c1.fingerprint()
+    fp_other = c1['other'].fingerprint()
+    c1['group.lst'][2]['str'] = 'changed'
+    assert c1.fingerprint() != fp
+    assert c1['group'].fingerprint() != c2['group'].fingerprint()
+    assert c1['other'].fingerprint() == fp_other
+    assert c1 != c2
+
+    c1['group.lst'][2]['str'] = 'value'
+    assert c1.fingerprint() == fp
+    assert c1 == c2
+
+    # Equal values of different types differ
+    c2['flt'] = -0.0
+    assert c1.fingerprint() == c2.fingerprint()
+    del c2['flt']
+    c2['flt'] = 0
+    assert c1.fingerprint() != c2.fingerprint()
+
+
+def test_freeze():
+    cfg = pyc.load_toml_str("""
+        [group]
+        int = 42
+        """)
+    assert not cfg.frozen
+    with pytest.raises(pyc.TypeError):
+        hash(cfg)
+
+    cfg.freeze()
+    assert cfg.frozen
+    assert cfg['group'].frozen
+    assert hash(cfg) == hash(cfg)
+    with pytest.raises(pyc.TypeError):
+        cfg['group.int'] = 3
+    with pytest.raises(pyc.TypeError):
+        cfg['group']['str'] = 'value'
+    with pytest.raises(pyc.TypeError):
+        del cfg['group']
+
+    # Frozen configurations can be used as dictionary keys
+    memo = {cfg: 'result'}
+    copy = cfg.copy()
+    assert not copy.frozen
+    copy.freeze()
+    assert memo[copy] == 'result'
+
 
 def test_copy():
     c1 = pyc.load_toml_str("""
@@ -945,6 +1161,63 @@ def test_container_interface():
     with pytest.raises(pyc.TypeError):
         cfg['group.lst'].items()
 
+    #### Lazy iterators
+    keys_man = cfg['group'].keys()
+    assert list(cfg['group'].iter_keys()) == keys_man
+    values_it = list(cfg['group'].iter_values())
+    assert len(values_it) == len(keys_man)
+    assert values_it[keys_man.index('int')] == 42
+    assert values_it[keys_man.index('dt')] == cfg['group'].dict('dt')
+    assert values_it[keys_man.index('lst')].list() == cfg['group'].list('lst')
+    items_it = list(cfg['group'].iter_items())
+    assert [key for key, _ in items_it] == keys_man
+    assert items_it[keys_man.index('int')] == ('int', 42)
+
+    # Aggregates are returned as views
+    for key, value in cfg['group'].iter_items():
+        if key == 'lst':
+            assert isinstance(value, type(cfg))
+            value[0] = 17
+            break
+    assert cfg['group.lst'][0] == 17
+
+    with pytest.raises(pyc.TypeError):
+        cfg['group.lst'].iter_keys()
+
+    with pytest.raises(pyc.TypeError):
+        cfg['group.lst'].iter_values()
+
+    with pytest.raises(pyc.TypeError):
+        cfg['group.lst'].iter_items()
+
+
+def make_large_config(num_params):
+    cfg = pyc.Config()
+    cfg['group'] = {f'param{idx}': idx for idx in range(num_params)}
+    cfg['lst'] = list(range(num_params))
+    return cfg
+
+
+def test_iterate_large_group():
+    num_params = 100000
+    cfg = make_large_config(num_params)
+    keys = list(cfg['group'])
+    assert len(keys) == num_params
+    assert set(keys) == {f'param{idx}' for idx in range(num_params)}
+    assert sum(value for value in cfg['lst']) == \
+        (num_params * (num_params - 1)) // 2
+
+
+@pytest.mark.benchmark
+def test_iterate_large_group_benchmark(elapsed):
+    # Each iteration step should be O(1), i.e. iterating 10x the number of
+    # parameters should take ~10x longer.
+    for num_params in [10000, 100000]:
+        cfg = make_large_config(num_params)
+        for key in ['group', 'lst']:
+            timing = elapsed(lambda: sum(1 for _ in cfg[key]))
+            print(f'Iterating {num_params} parameters ({key}): {timing:.4f}s')
+
 
 def test_get_numpy():
     cfg = pyc.load_toml_str("""
@@ -1,9 +1,13 @@
 import pytest
 import json
 import math
+import os
+import pickle
+import sys
 import pytz
 import toml
 import datetime
+import gzip
 from pathlib import Path
 from pyzeugkiste import config as pyc
 
@@ -114,6 +118,147 @@ def test_io_toml():
 # TODO Add test for JSON + None/null
 
 
+def test_serialize_views():
+    cfg = pyc.load_toml_str("""
+        value = 1
+
+        [group]
+        str = 'text'
+        lst = [1, 2, 3]
+
+        [group.nested]
+        flt = 2.5
+        """)
+    # The root is serialized in place, views to JSON as well (other formats
+    # via a copy of the viewed group)
+    assert pyc.load_toml_str(cfg.to_toml()) == cfg
+    assert pyc.load_json_str(cfg.to_json()) == cfg
+
+    view = cfg['group']
+    assert pyc.load_toml_str(view.to_toml()) == view
+    assert pyc.load_json_str(view.to_json()) == view
+    assert pyc.load_toml_str(view['nested'].to_toml()) == view['nested']
+    assert json.loads(view.to_json()) == json.loads(
+        pyc.load_toml_str(view.to_toml()).to_json())
+
+    # List views are serialized as a group holding the parameter "list"
+    lst = pyc.load_toml_str(view['lst'].to_toml())
+    assert lst['list'] == view['lst']
+    assert json.loads(view['lst'].to_json()) == {'list': [1, 2, 3]}
+
+    # Special values written by the in-place JSON serialization
+    cfg = pyc.load_toml_str("""
+        [special]
+        flt = 2.0
+        nan = nan
+        str = "quote \\" and backslash \\\\ \\n"
+        day = 2023-02-28
+        tm = 08:30:00.5
+        dt = 2000-02-29T17:30:15-12:10
+        """)
+    assert json.loads(cfg['special'].to_json()) == {
+        'flt': 2.0, 'nan': 'nan', 'str': 'quote " and backslash \\ \n',
+        'day': '2023-02-28', 'tm': '08:30:00.5',
+        'dt': '2000-02-29T17:30:15-12:10'}
+    assert isinstance(pyc.load_json_str(cfg['special'].to_json())['flt'], float)
+
+
+def test_serialize_views_json_matches_copy():
+    # Views are serialized to JSON in place, which must result in exactly the
+    # same output as werkzeugkiste's serialization of a copy (or the root).
+    lists = {
+        'nested': "[[1, 2.5, [true, 'x']], [], [{a = 1, b = [1979-05-27]}]]",
+        'floats': '[nan, inf, -inf, -0.0, 3.0, 1e300, 0.1]',
+    }
+    values = r"""
+        flt-integral = 2.0
+        flt-large = 1e22
+        flt-exp = 1.5e300
+        flt-small = -2.5e-12
+        flt-neg-zero = -0.0
+        flt-frac = 0.1
+        flt-nan = nan
+        flt-inf = -inf
+        int = -42
+        flag = false
+        empty-str = ''
+        ctrl = "tab\t bell\u0007 del\u007F esc\u001B nl\n"
+        quotes = 'say "hi" \ backslash'
+        unicode = "Unicode: äöü"
+        day = 2023-02-28
+        tm = 08:30:00.123456789
+        tm-frac = 08:30:00.5
+        dt-local = 2000-02-29T17:30:15.000000001
+        dt-utc = 2000-02-29T17:30:15Z
+        dt-neg = 2000-02-29T17:30:15.25-12:10
+        dt-pos = 2000-02-29T17:30:15+05:45
+        empty-grp = {}
+        """ + '\n'.join(f'{key} = {lst}' for key, lst in lists.items())
+    cfg = pyc.load_toml_str(f'[outer.grp]\n{values}')
+    root = pyc.load_toml_str(f'[grp]\n{values}')
+
+    for view in [cfg['outer'], cfg['outer.grp']]:
+        assert view.to_json() == view.copy().to_json()
+    assert cfg['outer'].to_json() == root.to_json()
+
+    # List views are serialized as a group holding the parameter "list"
+    for key, lst in lists.items():
+        expected = pyc.load_toml_str(f'list = {lst}')
+        assert cfg[f'outer.grp.{key}'].to_json() == expected.to_json()
+        assert root[f'grp.{key}'].to_json() == expected.to_json()
+
+
+def test_dump(tmp_path):
+    cfg = pyc.load_toml_file(data() / 'test-valid1.toml')
+
+    cfg.dump(tmp_path / 'out.toml')
+    assert (tmp_path / 'out.toml').read_text() == cfg.to_toml()
+    assert pyc.load(tmp_path / 'out.toml') == cfg
+
+    cfg.dump(str(tmp_path / 'out.json'))
+    assert (tmp_path / 'out.json').read_text() == cfg.to_json()
+
+    cfg.dump(tmp_path / 'out.cfg')
+    assert (tmp_path / 'out.cfg').read_text() == cfg.to_libconfig()
+
+    cfg.dump(tmp_path / 'out.txt', format='yaml')
+    assert (tmp_path / 'out.txt').read_text() == cfg.to_yaml()
+
+    # File objects (text and binary mode) require an explicit format
+    with open(tmp_path / 'text.toml', 'w') as f:
+        cfg.dump(f, format='toml')
+    assert (tmp_path / 'text.toml').read_text() == cfg.to_toml()
+    with open(tmp_path / 'binary.json', 'wb') as f:
+        cfg.dump(f, format='json')
+    assert (tmp_path / 'binary.json').read_text() == cfg.to_json()
+    with open(tmp_path / 'text.toml', 'w') as f:
+        with pytest.raises(pyc.ValueError):
+            cfg.dump(f)
+
+    # Views are dumped like their serialized string representation
+    view = cfg['section1']
+    view.dump(tmp_path / 'view.toml')
+    assert (tmp_path / 'view.toml').read_text() == view.to_toml()
+
+    try:
+        cfg.dump(tmp_path / 'out.toml.gz')
+        assert pyc.load(tmp_path / 'out.toml.gz') == cfg
+    except pyc.ParseError:
+        assert False
+    except RuntimeError:
+        # Raised if zlib is not available
+        pass
+
+    with pytest.raises(pyc.ValueError):
+        cfg.dump(tmp_path / 'out.unknown')
+    with pytest.raises(pyc.ValueError):
+        cfg.dump(tmp_path / 'out.toml', format='no-such-format')
+    with pytest.raises(pyc.TypeError):
+        cfg.dump(42)
+    with pytest.raises(OSError):
+        cfg.dump(tmp_path / 'no-such-dir' / 'out.toml')
+
+
 def test_nested():
     cfg = pyc.load_toml_file(data() / 'test-valid1.toml')
 
@@ -150,3 +295,824 @@ def test_nested():
     except RuntimeError:
         # Raised if libconfig is not available
         pass
+
+
+def test_load_all_nested(tmp_path):
+    lens = tmp_path / 'lens.toml'
+    lens.write_text('focal_length = 4.2\ndistortion = [0.1, -0.2]\n')
+    rig = tmp_path / 'rig.json'
+    rig.write_text('{"baseline": 0.12}')
+
+    cfg = pyc.load_toml_str(f"""
+        name = 'rig'
+        rig = '{rig.as_posix()}'
+        cams = ['{lens.as_posix()}', 3, '{lens.as_posix()}']
+
+        [cam1]
+        lens = '{lens.as_posix()}'
+        fps = 30
+
+        [cam2]
+        lens = '{lens.as_posix()}'
+        """)
+    cfg_lens = pyc.load_toml_file(lens)
+
+    assert cfg.load_all_nested(['*.lens', 'cams*', 'rig']) == 5
+    assert cfg['cam1.lens'] == cfg_lens
+    assert cfg['cam2.lens'] == cfg_lens
+    assert cfg['cam1.fps'] == 30
+    assert cfg['rig.baseline'] == pytest.approx(0.12)
+    assert cfg['name'] == 'rig'
+    assert len(cfg['cams']) == 3
+    assert cfg['cams'][0] == cfg_lens
+    assert cfg['cams'][1] == 3
+    assert cfg['cams'][2] == cfg_lens
+
+    # Nothing left to replace
+    assert cfg.load_all_nested(['*.lens', 'cams*']) == 0
+
+    # Missing files are reported, and the configuration stays unmodified
+    cfg = pyc.load_toml_str(f"""
+        lens1 = '{lens.as_posix()}'
+        lens2 = '{(tmp_path / 'missing.toml').as_posix()}'
+        """)
+    with pytest.raises(pyc.ParseError):
+        cfg.load_all_nested(['lens*'])
+    assert cfg['lens1'] == lens.as_posix()
+
+
+def test_threaded_loading():
+    # Loading functions release the GIL while parsing, thus multiple threads
+    # can parse configurations concurrently.
+    from concurrent.futures import ThreadPoolExecutor
+
+    toml_file = data() / 'test-valid1.toml'
+    json_file = data() / 'test-valid.json'
+    expected_toml = pyc.load_toml_file(toml_file)
+    expected_json = pyc.load_json_file(json_file)
+    toml_str = expected_toml.to_toml()
+
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        cfgs = list(pool.map(pyc.load_toml_file, [toml_file] * 16))
+        assert all(c == expected_toml for c in cfgs)
+
+        cfgs = list(pool.map(pyc.load, [json_file] * 16))
+        assert all(c == expected_json for c in cfgs)
+
+        cfgs = list(pool.map(pyc.load_toml_str, [toml_str] * 16))
+        assert all(c == expected_toml for c in cfgs)
+
+        # Errors must still be propagated from within the worker threads
+        future = pool.submit(pyc.load_toml_file, data() / 'test-invalid.toml')
+        with pytest.raises(pyc.ParseError):
+            future.result()
+
+
+def make_large_config(index, num_sections=2000):
+    cfg = pyc.Config()
+    cfg['index'] = index
+    for idx in range(num_sections):
+        cfg[f'section{idx}'] = {
+            'int': idx, 'flt': idx + 0.5, 'str': f'value{idx}',
+            'lst': list(range(10))}
+    return cfg
+
+
+def write_large_configs(tmp_path, num_files, num_sections=2000):
+    # Writes distinct configurations as TOML and JSON files.
+    toml_files, json_files, expected = [], [], []
+    for index in range(num_files):
+        cfg = make_large_config(index, num_sections)
+        toml_files.append(tmp_path / f'large{index}.toml')
+        toml_files[-1].write_text(cfg.to_toml())
+        json_files.append(tmp_path / f'large{index}.json')
+        json_files[-1].write_text(cfg.to_json())
+        expected.append(cfg)
+    return toml_files, json_files, expected
+
+
+def test_threaded_loading_large(tmp_path):
+    # Loading on a thread pool yields the same configurations, in the same
+    # order, as loading one file after another.
+    from concurrent.futures import ThreadPoolExecutor
+
+    toml_files, json_files, expected = write_large_configs(
+        tmp_path, 8, num_sections=200)
+    with ThreadPoolExecutor(max_workers=4) as pool:
+        for files, load in [(toml_files, pyc.load_toml_file),
+                            (json_files, pyc.load_json_file),
+                            (toml_files + json_files, pyc.load)]:
+            sequential = [load(fname) for fname in files]
+            threaded = list(pool.map(load, files))
+            assert threaded == sequential
+        assert list(pool.map(pyc.load, toml_files)) == expected
+
+
+@pytest.mark.benchmark
+def test_threaded_loading_benchmark(tmp_path, elapsed):
+    # As parsing releases the GIL, a thread pool should load multiple
+    # configurations faster than a single thread.
+    from concurrent.futures import ThreadPoolExecutor
+
+    num_workers = os.cpu_count() or 1
+    toml_files, json_files, _ = write_large_configs(tmp_path, 2 * num_workers)
+    with ThreadPoolExecutor(max_workers=num_workers) as pool:
+        for files, load in [(toml_files, pyc.load_toml_file),
+                            (json_files, pyc.load_json_file)]:
+            sequential = elapsed(lambda: [load(fname) for fname in files])
+            threaded = elapsed(lambda: list(pool.map(load, files)))
+            print(f'{load.__name__}: {len(files)} files took '
+                  f'{sequential:.3f}s sequentially and {threaded:.3f}s on '
+                  f'{num_workers} threads')
+
+
+def test_load_many():
+    files = [
+        data() / 'test-valid1.toml',
+        data() / 'test-valid.json',
+        str(data() / 'test-valid2.toml')]
+    expected = [pyc.load(f) for f in files]
+
+    # Results are returned in input order
+    for num_threads in [0, 1, 2, 8]:
+        cfgs = pyc.load_many(files * 3, num_threads=num_threads)
+        assert len(cfgs) == 9
+        for idx, cfg in enumerate(cfgs):
+            assert isinstance(cfg, pyc.Config)
+            assert cfg == expected[idx % 3]
+
+    assert [] == pyc.load_many([])
+
+    # All errors are collected into a single ParseError
+    with pytest.raises(pyc.ParseError) as exc:
+        pyc.load_many(files + ['no-such-file.toml', data() / 'test-invalid.toml'])
+    assert 'no-such-file.toml' in str(exc.value)
+    assert 'test-invalid.toml' in str(exc.value)
+    assert '2 of 5' in str(exc.value)
+
+
+def test_load_async():
+    import asyncio
+
+    files = [data() / 'test-valid1.toml', data() / 'test-valid2.toml',
+             data() / 'test-valid.json']
+
+    async def load_all():
+        single = await asyncio.gather(*[pyc.load_async(f) for f in files])
+        many = await pyc.load_many_async(f for f in files)
+        return single, many
+
+    single, many = asyncio.run(load_all())
+    for fname, cfg1, cfg2 in zip(files, single, many):
+        assert cfg1 == pyc.load(fname)
+        assert cfg2 == cfg1
+
+    with pytest.raises(pyc.ParseError):
+        asyncio.run(pyc.load_async(data() / 'test-invalid.toml'))
+    with pytest.raises(pyc.ParseError):
+        asyncio.run(pyc.load_many_async(['no-such-file.toml']))
+
+
+def test_load_mmap(tmp_path):
+    toml_file = data() / 'test-valid1.toml'
+    cfg = pyc.load_toml_file(toml_file, mmap=True)
+    assert cfg == pyc.load_toml_file(toml_file)
+
+    json_file = data() / 'test-valid.json'
+    for policy in [pyc.NullValuePolicy.Skip, pyc.NullValuePolicy.NullString]:
+        cfg = pyc.load_json_file(json_file, none_policy=policy, mmap=True)
+        assert cfg == pyc.load_json_file(json_file, none_policy=policy)
+
+    # Empty files are valid TOML/JSON objects
+    empty = tmp_path / 'empty.toml'
+    empty.write_text('')
+    assert pyc.load_toml_file(empty, mmap=True).empty()
+
+    with pytest.raises(pyc.ParseError):
+        pyc.load_toml_file('no-such-file.toml', mmap=True)
+
+    with pytest.raises(pyc.ParseError) as exc:
+        pyc.load_toml_file(data() / 'test-invalid.toml', mmap=True)
+    assert 'test-invalid.toml' in str(exc.value)
+
+
+def test_load_json_lazy(tmp_path):
+    json_file = data() / 'test-valid.json'
+    expected = pyc.load_json_file(json_file)
+
+    cfg = pyc.load_json_file(json_file, lazy=True)
+    assert cfg['grp.str'] == 'value'
+    assert cfg.int('int') == 1
+    assert cfg['nested[3][3][0]'] == 'four'
+    assert cfg['nested'][4]['int'] == 42
+    assert 'grp' in cfg
+    assert 'no-such-key' not in cfg
+    with pytest.raises(pyc.KeyError):
+        cfg['no-such-key']
+    # Operations on the full configuration parse all remaining parameters
+    assert sorted(cfg.keys()) == sorted(expected.keys())
+    assert cfg == expected
+    assert pyc.load_json_file(json_file, lazy=True) == expected
+    assert pyc.load_json_file(json_file, lazy=True).to_dict() == \
+        expected.to_dict()
+
+    # Modifications require the full configuration
+    cfg = pyc.load_json_file(json_file, lazy=True)
+    cfg['flt'] = 3.5
+    assert cfg['flt'] == pytest.approx(3.5)
+    assert cfg['arr1'].list() == expected['arr1'].list()
+
+    # Null values are handled upon access
+    fname = tmp_path / 'null.json'
+    fname.write_text('{"a": null, "b": [1, null], "c": {"d": null}}')
+    cfg = pyc.load_json_file(
+        fname, none_policy=pyc.NullValuePolicy.NullString, lazy=True)
+    assert cfg['a'] == 'null'
+    assert cfg['b'].list() == [1, 'null']
+    cfg = pyc.load_json_file(fname, lazy=True)
+    assert 'a' not in cfg
+    assert cfg['c'].empty()
+
+    # Already parsed and pending parameters are merged (regardless of which
+    # set is larger)
+    fname = tmp_path / 'merge.json'
+    fname.write_text('{"a": 1, "b": [2], "c": {"d": 3}, "e": 4, "a": 5}')
+    expected = {'a': 5, 'b': [2], 'c': {'d': 3}, 'e': 4}
+    cfg = pyc.load_json_file(fname, lazy=True)
+    assert cfg['c.d'] == 3
+    assert cfg.to_dict() == expected
+    cfg = pyc.load_json_file(fname, lazy=True)
+    assert cfg['a'] == 5
+    assert cfg['b'].list() == [2]
+    assert cfg['c.d'] == 3
+    assert cfg.to_dict() == expected
+
+    # Structural errors are detected while loading, ...
+    fname = tmp_path / 'invalid.json'
+    fname.write_text('{"a": 1, "b": [1, 2}')
+    with pytest.raises(pyc.ParseError):
+        pyc.load_json_file(fname, lazy=True)
+    with pytest.raises(pyc.ParseError):
+        pyc.load_json_file('no-such-file.json', lazy=True)
+    # ... whereas syntax errors within a value are reported upon access
+    fname.write_text('{"a": 1, "b": [1, 2 3]}')
+    cfg = pyc.load_json_file(fname, lazy=True)
+    assert cfg['a'] == 1
+    with pytest.raises(pyc.ParseError) as exc:
+        cfg['b']
+    assert 'invalid.json' in str(exc.value)
+
+
+def test_load_gzip(tmp_path):
+    toml_file = data() / 'test-valid1.toml'
+    toml_gz = tmp_path / 'compressed.toml.gz'
+    toml_gz.write_bytes(gzip.compress(toml_file.read_bytes()))
+    expected = pyc.load_toml_file(toml_file)
+
+    try:
+        cfg = pyc.load(toml_gz)
+    except pyc.ParseError:
+        assert False
+    except RuntimeError:
+        # Raised if zlib is not available
+        return
+    assert cfg == expected
+    assert pyc.load(toml_gz, cached=True) == expected
+    assert pyc.load_toml_file(toml_gz) == expected
+    # Compression is detected by content, thus the extension doesn't matter
+    # for the type-specific loaders. Memory-mapping is ignored.
+    toml_misnamed = tmp_path / 'compressed.toml'
+    toml_misnamed.write_bytes(toml_gz.read_bytes())
+    assert pyc.load_toml_file(toml_misnamed, mmap=True) == expected
+    assert pyc.load(toml_misnamed) == expected
+
+    json_file = data() / 'test-valid.json'
+    json_gz = tmp_path / 'compressed.JSON.gz'
+    # Concatenated gzip members must be decompressed as a whole
+    content = json_file.read_bytes()
+    half = len(content) // 2
+    json_gz.write_bytes(
+        gzip.compress(content[:half]) + gzip.compress(content[half:]))
+    assert pyc.load(json_gz) == pyc.load_json_file(json_file)
+    for policy in [pyc.NullValuePolicy.Skip, pyc.NullValuePolicy.NullString]:
+        assert pyc.load_json_file(json_gz, none_policy=policy) == \
+            pyc.load_json_file(json_file, none_policy=policy)
+    assert pyc.load_many([toml_gz, json_gz]) == [
+        expected, pyc.load_json_file(json_file)]
+
+    # Truncated or corrupted archives
+    truncated = tmp_path / 'truncated.toml.gz'
+    truncated.write_bytes(toml_gz.read_bytes()[:-10])
+    with pytest.raises(pyc.ParseError) as exc:
+        pyc.load(truncated)
+    assert 'truncated.toml.gz' in str(exc.value)
+
+    corrupted = tmp_path / 'corrupted.toml.gz'
+    corrupted.write_bytes(toml_gz.read_bytes()[:10] + b'\xff' * 32)
+    with pytest.raises(pyc.ParseError):
+        pyc.load_toml_file(corrupted)
+
+    # The type cannot be deduced from the inner extension
+    unknown = tmp_path / 'compressed.gz'
+    unknown.write_bytes(toml_gz.read_bytes())
+    with pytest.raises(pyc.ParseError):
+        pyc.load(unknown)
+
+    # Syntax errors within the decompressed contents
+    invalid = tmp_path / 'invalid.toml.gz'
+    invalid.write_bytes(gzip.compress(
+        (data() / 'test-invalid.toml').read_bytes()))
+    with pytest.raises(pyc.ParseError) as exc:
+        pyc.load(invalid)
+    assert 'invalid.toml.gz' in str(exc.value)
+
+
+def test_load_yaml(tmp_path):
+    yaml_str = """
+    flag: true
+    answer: 42
+    hex: 0x1F
+    pi: 3.5
+    neg-inf: -.inf
+    str: "42"
+    text: hello world
+    day: 2023-02-28
+    not-a-day: 2023-13-45
+    tm: 08:30:15
+    dt: 2023-02-28T12:00:00Z
+    none: ~
+    lst: [1, two, [3, 4], {a: 1}, null]
+    grp:
+      nested:
+        x: &anchor 7
+      y: *anchor
+    """
+    try:
+        cfg = pyc.load_yaml_str(yaml_str)
+    except pyc.ParseError:
+        assert False
+    except RuntimeError:
+        # Raised if yaml-cpp is not available
+        return
+
+    assert cfg['flag'] is True
+    assert cfg['answer'] == 42
+    assert cfg['hex'] == 31
+    assert cfg['pi'] == pytest.approx(3.5)
+    assert math.isinf(cfg['neg-inf']) and cfg['neg-inf'] < 0
+    assert cfg['str'] == '42'
+    assert cfg['text'] == 'hello world'
+    assert cfg['day'] == datetime.date(2023, 2, 28)
+    assert cfg['not-a-day'] == '2023-13-45'
+    assert cfg['tm'] == datetime.time(8, 30, 15)
+    assert cfg.type('dt') == pyc.ConfigType.DateTime
+    assert 'none' not in cfg
+    assert cfg['lst'].list() == [1, 'two', [3, 4], {'a': 1}]
+    assert cfg['grp.nested.x'] == 7
+    assert cfg['grp.y'] == 7
+
+    cfg = pyc.load_yaml_str(
+        yaml_str, none_policy=pyc.NullValuePolicy.NullString)
+    assert cfg['none'] == 'null'
+    assert cfg['lst[4]'] == 'null'
+    with pytest.raises(pyc.ParseError):
+        pyc.load_yaml_str(yaml_str, none_policy=pyc.NullValuePolicy.Fail)
+
+    # Empty documents are valid, but the top-level node must be a mapping
+    assert pyc.load_yaml_str('').empty()
+    with pytest.raises(pyc.ParseError):
+        pyc.load_yaml_str('[1, 2]')
+    with pytest.raises(pyc.ParseError):
+        pyc.load_yaml_str('a: [1')
+    with pytest.raises(pyc.ParseError):
+        pyc.load_yaml_str('invalid.key: 1')
+
+    # File loading, also via the extension-based loader
+    fname = tmp_path / 'config.yml'
+    fname.write_text(yaml_str)
+    expected = pyc.load_yaml_str(yaml_str)
+    assert pyc.load_yaml_file(fname) == expected
+    assert pyc.load_yaml_file(fname, mmap=True) == expected
+    assert pyc.load(fname) == expected
+    fname = tmp_path / 'config.yaml'
+    fname.write_text(yaml_str)
+    assert pyc.load(fname) == expected
+    with pytest.raises(pyc.ParseError):
+        pyc.load_yaml_file(tmp_path / 'no-such-file.yaml')
+
+    # Exported YAML can be loaded again
+    cfg = pyc.load_toml_str("""
+        str = 'value'
+        int = 3
+        flt = 0.5
+        lst = [1, 2, [3, 'four']]
+        day = 2023-02-28
+
+        [grp]
+        flag = false
+        """)
+    assert pyc.load_yaml_str(cfg.to_yaml()) == cfg
+
+
+def test_iter_json_lines(tmp_path):
+    fname = tmp_path / 'records.jsonl'
+    with open(fname, 'w') as f:
+        for idx in range(100):
+            f.write(json.dumps({'idx': idx, 'name': f'rec{idx}', 'opt': None}))
+            f.write('\r\n' if idx % 2 else '\n')
+            if idx == 50:
+                f.write('   \n')
+
+    for prefetch in [0, 1, 8]:
+        records = list(pyc.iter_json_lines(fname, prefetch=prefetch))
+        assert len(records) == 100
+        for idx, rec in enumerate(records):
+            assert isinstance(rec, pyc.Config)
+            assert rec['idx'] == idx
+            assert rec['name'] == f'rec{idx}'
+            assert 'opt' not in rec
+
+    records = pyc.iter_json_lines(
+        fname, none_policy=pyc.NullValuePolicy.NullString)
+    assert next(records)['opt'] == 'null'
+
+    # Parsing errors report the line number and iteration can continue
+    with open(fname, 'a') as f:
+        f.write('{"invalid": \n{"idx": 100}')
+    it = pyc.iter_json_lines(fname)
+    for _ in range(100):
+        next(it)
+    with pytest.raises(pyc.ParseError) as exc:
+        next(it)
+    assert 'line 102' in str(exc.value)
+    assert next(it)['idx'] == 100
+    with pytest.raises(StopIteration):
+        next(it)
+
+    # Abandoning a prefetching iterator must not block
+    it = pyc.iter_json_lines(fname, prefetch=2)
+    next(it)
+    del it
+
+    with pytest.raises(pyc.ParseError):
+        pyc.iter_json_lines(tmp_path / 'no-such-file.jsonl')
+
+
+def test_load_cached(tmp_path):
+    previous_limit = pyc.cache_info()['limit']
+    pyc.clear_cache()
+    pyc.set_cache_limit(2)
+    try:
+        fname = tmp_path / 'cached.toml'
+        fname.write_text('value = 1\n')
+
+        # Uncached loads do not touch the cache
+        pyc.load(fname)
+        assert pyc.cache_info()['misses'] == 0
+
+        cfg1 = pyc.load(fname, cached=True)
+        cfg2 = pyc.load(str(fname), cached=True)
+        info = pyc.cache_info()
+        assert info['hits'] == 1
+        assert info['misses'] == 1
+        assert info['entries'] == 1
+        assert info['limit'] == 2
+        assert cfg1 == cfg2
+
+        # Cache hits share the parsed configuration, which is copied upon
+        # the first modification
+        cfg1['value'] = 2
+        assert cfg2['value'] == 1
+        assert pyc.load(fname, cached=True)['value'] == 1
+        cfg3 = pyc.load(fname, cached=True)
+        cfg3['group'] = {'param': 1}
+        view = cfg3['group']
+        view['param'] = 2
+        assert cfg3['group.param'] == 2
+        assert 'group' not in pyc.load(fname, cached=True)
+
+        # Modified files are reloaded
+        fname.write_text('value = 3\nother = 4\n')
+        assert pyc.load(fname, cached=True)['value'] == 3
+        assert pyc.cache_info()['misses'] == 2
+
+        # Least recently used entries are evicted
+        for name in ['a', 'b', 'c']:
+            other = tmp_path / f'{name}.json'
+            other.write_text('{"name": "' + name + '"}')
+            assert pyc.load(other, cached=True)['name'] == name
+        assert pyc.cache_info()['entries'] == 2
+
+        with pytest.raises(pyc.ParseError):
+            pyc.load(tmp_path / 'no-such-file.toml', cached=True)
+
+        pyc.clear_cache()
+        info = pyc.cache_info()
+        assert info['entries'] == 0
+        assert info['hits'] == 0
+    finally:
+        pyc.set_cache_limit(previous_limit)
+        pyc.clear_cache()
+
+
+def test_binary(tmp_path):
+    for cfg in [pyc.load_toml_file(data() / 'test-valid1.toml'),
+                pyc.load_toml_file(data() / 'test-valid2.toml'),
+                pyc.load_json_file(data() / 'test-valid.json')]:
+        encoded = cfg.to_binary()
+        assert isinstance(encoded, bytes)
+        assert pyc.load_binary(encoded) == cfg
+        # Trailing bytes (e.g. padding of a shared buffer) are ignored
+        assert pyc.load_binary(bytearray(encoded) + b'\0' * 10) == cfg
+        assert pyc.load_binary(memoryview(encoded)) == cfg
+
+        fname = tmp_path / 'snapshot.bin'
+        fname.write_bytes(encoded)
+        assert pyc.load_binary(fname) == cfg
+        assert pyc.load_binary(str(fname)) == cfg
+
+        with pytest.raises(pyc.ParseError):
+            pyc.load_binary(encoded[:-1])
+
+    # All types are preserved
+    cfg = pyc.Config()
+    cfg['flag'] = True
+    cfg['int'] = -(2**62)
+    cfg['flt'] = 1.5e-3
+    cfg['str'] = 'Unicode: äöü'
+    cfg['day'] = datetime.date(2023, 2, 28)
+    cfg['time'] = datetime.time(8, 30, 0, 123000)
+    offset = datetime.timezone(datetime.timedelta(minutes=-90))
+    cfg['dt'] = datetime.datetime(2023, 2, 28, 8, 30, tzinfo=offset)
+    cfg['lst'] = [1, 'two', [3.0, 4], {'five': 5}]
+    cfg['group'] = {'nested': {'value': 6}, 'empty': {}}
+    reloaded = pyc.load_binary(cfg.to_binary())
+    assert reloaded == cfg
+    assert reloaded['dt'] == cfg['dt']
+    assert reloaded['time'] == cfg['time']
+
+    # Views are encoded like in the text formats
+    assert pyc.load_binary(cfg['group'].to_binary()) == cfg['group']
+    assert pyc.load_binary(cfg['lst'].to_binary())['list'] == cfg['lst']
+
+    with pytest.raises(pyc.ParseError):
+        pyc.load_binary(b'')
+    with pytest.raises(pyc.ParseError):
+        pyc.load_binary(cfg.to_toml().encode('utf-8'))
+    with pytest.raises(pyc.ParseError):
+        pyc.load_binary(tmp_path / 'no-such-file.bin')
+
+    # Malformed data must not overflow the stack, i.e. the nesting depth is
+    # limited. Payload: groups (tag 9) or lists (tag 8) with a single
+    # (nested) child each.
+    def encode(payload):
+        return b'PZKC\x01\0\0\0' + len(payload).to_bytes(8, 'little') + payload
+    deep_groups = b'\x01\x01a\x09' * 100000 + b'\x00'
+    deep_lists = b'\x01\x01a\x08' + b'\x01\x08' * 100000 + b'\x00'
+    for payload in [deep_groups, deep_lists]:
+        with pytest.raises(pyc.ParseError) as exc:
+            pyc.load_binary(encode(payload))
+        assert 'depth' in str(exc.value)
+    # Reasonably nested configurations can still be decoded
+    nested, lst = {'value': 1}, [1]
+    for _ in range(100):
+        nested, lst = {'a': nested}, [lst]
+    cfg = pyc.Config()
+    cfg['nested'] = nested
+    cfg['lst'] = lst
+    assert pyc.load_binary(encode(b'\x00')).empty()
+    assert pyc.load_binary(cfg.to_binary()) == cfg
+
+
+def replicate_test_data(fname, load_text, num_copies):
+    # Returns a configuration holding multiple copies of the test data file.
+    single = load_text(fname)
+    cfg = pyc.Config()
+    for idx in range(num_copies):
+        cfg[f'copy{idx}'] = single
+    return cfg
+
+
+def test_binary_large(tmp_path):
+    # Binary snapshots of larger configurations round-trip, also when loaded
+    # from a file.
+    for fname, load_text in [(data() / 'test-valid1.toml', pyc.load_toml_file),
+                             (data() / 'test-valid2.toml', pyc.load_toml_file),
+                             (data() / 'test-valid.json', pyc.load_json_file)]:
+        cfg = replicate_test_data(fname, load_text, 100)
+        binary_file = tmp_path / 'large.bin'
+        binary_file.write_bytes(cfg.to_binary())
+        assert pyc.load_binary(binary_file) == cfg
+        assert pyc.load_binary(cfg.to_binary()) == cfg
+
+
+@pytest.mark.benchmark
+def test_binary_benchmark(tmp_path, elapsed):
+    # Loading a binary snapshot should be faster than parsing the
+    # corresponding TOML/JSON file. The test data is replicated to measure
+    # the decoding instead of the per-call overhead.
+    for fname, load_text in [(data() / 'test-valid1.toml', pyc.load_toml_file),
+                             (data() / 'test-valid2.toml', pyc.load_toml_file),
+                             (data() / 'test-valid.json', pyc.load_json_file)]:
+        cfg = replicate_test_data(fname, load_text, 1000)
+        text_file = tmp_path / f'large{fname.suffix}'
+        text_file.write_text(
+            cfg.to_toml() if fname.suffix == '.toml' else cfg.to_json())
+        binary_file = tmp_path / 'large.bin'
+        binary_file.write_bytes(cfg.to_binary())
+
+        timing_text = elapsed(lambda: load_text(text_file))
+        timing_binary = elapsed(lambda: pyc.load_binary(binary_file))
+        print(f'{fname.name} x1000: {load_text.__name__} took '
+              f'{timing_text:.4f}s, load_binary took {timing_binary:.4f}s')
+
+
+def test_pickle():
+    cfg = pyc.load_toml_file(data() / 'test-valid1.toml')
+    cfg['numbers'] = list(range(1000))
+    cfg['day'] = datetime.date(2023, 2, 28)
+
+    for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+        restored = pickle.loads(pickle.dumps(cfg, protocol=protocol))
+        assert isinstance(restored, pyc.Config)
+        assert restored == cfg
+
+    # Views on groups can be pickled, views on lists can't
+    restored = pickle.loads(pickle.dumps(cfg['section1']))
+    assert restored == cfg['section1']
+    with pytest.raises(pyc.TypeError):
+        pickle.dumps(cfg['numbers'])
+
+    # Protocol 5 supports out-of-band buffers
+    if pickle.HIGHEST_PROTOCOL >= 5:
+        buffers = []
+        data_oob = pickle.dumps(cfg, protocol=5, buffer_callback=buffers.append)
+        assert len(buffers) == 1
+        assert len(data_oob) < len(pickle.dumps(cfg, protocol=5))
+        restored = pickle.loads(data_oob, buffers=buffers)
+        assert restored == cfg
+
+        # The restored configuration is independent of the buffer
+        restored['day'] = datetime.date(2000, 1, 1)
+        assert cfg['day'] == datetime.date(2023, 2, 28)
+
+
+@pytest.mark.skipif(sys.version_info < (3, 8),
+                    reason='requires multiprocessing.shared_memory')
+def test_shared_memory():
+    cfg = pyc.load_toml_file(data() / 'test-valid1.toml')
+    cfg['numbers'] = list(range(100))
+
+    shm = pyc.to_shared_memory(cfg)
+    try:
+        attached = pyc.load_shared_memory(shm.name)
+        assert attached == cfg
+        assert attached.int('value1') == 1
+        assert attached.numpy('numbers').shape == (100,)
+
+        # The shared block is not affected by changes to the loaded config
+        attached['value1'] = 42
+        assert pyc.load_shared_memory(shm.name)['value1'] == 1
+    finally:
+        shm.close()
+        shm.unlink()
+
+    with pytest.raises(FileNotFoundError):
+        pyc.load_shared_memory(shm.name)
+
+
+@pytest.mark.skipif(sys.version_info < (3, 8),
+                    reason='requires multiprocessing.shared_memory')
+def test_shared_memory_attach_from_other_process():
+    import subprocess
+
+    cfg = pyc.load_toml_str('value = 1')
+    shm = pyc.to_shared_memory(cfg)
+    try:
+        # An independent process uses its own resource tracker, which must
+        # not unlink the block when the attaching process exits.
+        script = (
+            'import sys\n'
+            'from pyzeugkiste import config as pyc\n'
+            'assert pyc.load_shared_memory(sys.argv[1])["value"] == 1\n')
+        result = subprocess.run(
+            [sys.executable, '-c', script, shm.name],
+            capture_output=True, text=True, timeout=60)
+        assert result.returncode == 0, result.stderr
+        assert 'leaked' not in result.stderr
+
+        assert pyc.load_shared_memory(shm.name) == cfg
+    finally:
+        shm.close()
+        shm.unlink()
+
+
+@pytest.mark.skipif(not sys.platform.startswith('linux'),
+                    reason='file monitoring requires inotify')
+def test_watch(tmp_path):
+    import queue
+
+    main_file = tmp_path / 'main.toml'
+    main_file.write_text('value = 1\nnested = "nested.json"\n')
+    nested_file = tmp_path / 'nested.json'
+    nested_file.write_text('{"param": "a"}')
+
+    cfg = pyc.load(main_file)
+    cfg['nested'] = str(nested_file)
+    cfg.load_nested('nested')
+
+    # Configurations which have not been loaded from a file can't be watched
+    with pytest.raises(pyc.ValueError):
+        pyc.load_toml_str('value = 1').watch(lambda c, k: None)
+    with pytest.raises(pyc.ValueError):
+        cfg['nested'].watch(lambda c, k: None)
+
+    reloaded = queue.Queue()
+    errors = queue.Queue()
+    with cfg.watch(lambda c, k: reloaded.put((c, k)), debounce=0.05,
+                   on_error=errors.put) as watcher:
+        assert watcher.running
+        assert len(watcher.files) == 2
+
+        nested_file.write_text('{"param": "b", "other": 2}')
+        new_cfg, changed = reloaded.get(timeout=5)
+        assert changed == {'nested.param', 'nested.other'}
+        assert new_cfg['value'] == 1
+        assert new_cfg['nested.param'] == 'b'
+        # The watched configuration is not modified
+        assert cfg['nested.param'] == 'a'
+
+        # Editors often replace the file
+        tmp_file = tmp_path / 'main.tmp'
+        tmp_file.write_text('value = 2\nnested = "nested.json"\n')
+        tmp_file.rename(main_file)
+        new_cfg, changed = reloaded.get(timeout=5)
+        assert changed == {'value'}
+        assert new_cfg['nested.other'] == 2
+
+        # Parsing errors are reported, the next modification reloads again
+        main_file.write_text('value = \n')
+        assert isinstance(errors.get(timeout=5), pyc.ParseError)
+        main_file.write_text('value = 3\nnested = "nested.json"\n')
+        new_cfg, changed = reloaded.get(timeout=5)
+        assert changed == {'value'}
+        assert new_cfg['value'] == 3
+    assert not watcher.running
+    assert reloaded.empty()
+
+
+@pytest.mark.skipif(not sys.platform.startswith('linux'),
+                    reason='file monitoring requires inotify')
+def test_watch_stopped_by_callback(tmp_path):
+    import threading
+
+    main_file = tmp_path / 'main.toml'
+    main_file.write_text('value = 1\n')
+    cfg = pyc.load(main_file)
+
+    # The callback stops the watcher and drops its last reference, i.e. the
+    # watcher is destroyed on its own background thread.
+    watchers = []
+    done = threading.Event()
+
+    def on_reload(c, k):
+        watcher = watchers.pop()
+        watcher.stop()
+        del watcher
+        done.set()
+
+    watchers.append(cfg.watch(on_reload, debounce=0.05))
+    main_file.write_text('value = 2\n')
+    assert done.wait(timeout=5)
+    assert not watchers
+
+
+@pytest.mark.skipif(not sys.platform.startswith('linux'),
+                    reason='file monitoring requires inotify')
+def test_watch_nested_compressed(tmp_path):
+    import queue
+
+    # Nested files are reloaded by the same loader as `load_all_nested`
+    nested_file = tmp_path / 'nested.json.gz'
+    nested_file.write_bytes(gzip.compress(b'{"param": "a"}'))
+    main_file = tmp_path / 'main.toml'
+    main_file.write_text(f'nested = "{nested_file.as_posix()}"\n')
+    cfg = pyc.load(main_file)
+    try:
+        assert cfg.load_all_nested(['nested']) == 1
+    except pyc.ParseError:
+        assert False
+    except RuntimeError:
+        # Raised if zlib is not available
+        return
+    assert cfg['nested.param'] == 'a'
+
+    reloaded = queue.Queue()
+    errors = queue.Queue()
+    with cfg.watch(lambda c, k: reloaded.put((c, k)), debounce=0.05,
+                   on_error=errors.put):
+        nested_file.write_bytes(gzip.compress(b'{"param": "b"}'))
+        new_cfg, changed = reloaded.get(timeout=5)
+        assert changed == {'nested.param'}
+        assert new_cfg['nested.param'] == 'b'
+    assert errors.empty()
@@ -410,6 +410,13 @@ def test_datetime():
     assert pytest.approx(-43800.0) == cfg['dt4'].utcoffset().total_seconds()
     assert pytest.approx(60.0) == cfg['dt5'].utcoffset().total_seconds()
 
+    # Zero offsets map to the UTC singleton, other offsets reuse their timezone
+    assert cfg['dt2'].tzinfo is datetime.timezone.utc
+    assert cfg['dt3'].tzinfo is datetime.timezone.utc
+    assert cfg['dt4'].tzinfo is cfg['dt4'].tzinfo
+    assert cfg['dt4'].tzinfo == datetime.timezone(
+        -datetime.timedelta(hours=12, minutes=10))
+
     assert cfg['dt2'] == cfg['dt3']
     assert cfg['dt2'] == (cfg['dt4'] - datetime.timedelta(hours=12, minutes=10))
     assert cfg['dt2'] == (cfg['dt5'] + datetime.timedelta(minutes=1))